@@ -984,6 +984,18 @@
   // and processor overload (too many expensive sqrt calls).
   #define DEFAULT_SEGMENTS_PER_SECOND 200
 
+  // Convert segmented moves to tower positions in batches, stepping the
+  // squared column heights by forward differences instead of full IK.
+  // Not compatible with SKEW_CORRECTION or 3-point / linear leveling.
+  //#define DELTA_IK_BATCH
+  #if ENABLED(DELTA_IK_BATCH)
+    #define DELTA_IK_BATCH_SIZE 8           // Segments converted per batch (2-32)
+    // Also replace most square roots with a 2nd order Taylor step.
+    // Best for boards without an FPU, where SQRT is slow.
+    //#define DELTA_IK_TAYLOR
+    #define DELTA_IK_TAYLOR_TOLERANCE 0.001 // (mm) Error bound before an exact square root is taken
+  #endif
+
   // After homing move down to a height where XY movement is unconstrained
   //#define DELTA_HOME_TO_SAFE_ZONE
 
@@ -1496,6 +1508,9 @@
 //#define BD_SENSOR
 #if ENABLED(BD_SENSOR)
   //#define BD_SENSOR_PROBE_NO_STOP // Probe bed without stopping at each probe point
+  #if ENABLED(BD_SENSOR_PROBE_NO_STOP)
+    //#define BD_SENSOR_SWEEP_WINDOW 2.0 // (mm) Sample continuously and fit all readings within this distance of each point
+  #endif
 #endif
 
 /**
@@ -1725,6 +1740,10 @@
 
 #define Z_PROBE_LOW_POINT          -2 // (mm) Farthest distance below the trigger-point to go before stopping
 
+//#define Z_CLEARANCE_FROM_BED    // Raise Z_CLEARANCE_BETWEEN_PROBES above the bed height just measured, not above Z=0.
+                                  // Travel allows for the bed rising to the next point at the steepest slope measured.
+//#define PROBE_QUEUE_RAISE       // Queue the raise after each probe point so it overlaps the travel to the next one
+
 // For M851 provide ranges for adjusting the X, Y, and Z probe offsets
 //#define PROBE_OFFSET_XMIN -50   // (mm)
 //#define PROBE_OFFSET_XMAX  50   // (mm)
@@ -2197,6 +2216,31 @@
       #define BILINEAR_SUBDIVISIONS 3
     #endif
 
+    //
+    // Precompute the interpolation coefficients of every grid cell so each
+    // Z correction is one cell lookup and three multiply-adds.
+    // Uses 16 bytes of SRAM per (subdivided) cell.
+    //
+    //#define ABL_BILINEAR_COEFFICIENTS
+
+    //
+    // Interpolate with the Catmull-Rom surface through the grid points
+    // instead of linearly within each cell. Gives the smooth result of
+    // ABL_BILINEAR_SUBDIVISION without its extra grid in SRAM, so
+    // finer meshes (e.g., 30x30) fit on 32-bit boards.
+    //
+    //#define ABL_BICUBIC_INTERPOLATION
+
+    //
+    // Add 'G29 M' to re-probe only the stored mesh points covering the
+    // area given by L R F B (e.g., the print bounds from the slicer)
+    // and merge them into the existing mesh.
+    //
+    //#define ABL_PRINT_AREA_PROBING
+    #if ENABLED(ABL_PRINT_AREA_PROBING)
+      #define ABL_PRINT_AREA_MARGIN 5 // (mm) Extra margin around the given area
+    #endif
+
   #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
@@ -2213,6 +2257,19 @@
 
   //#define UBL_HILBERT_CURVE       // Use Hilbert distribution for less travel when probing multiple points
 
+  //#define UBL_ADAPTIVE_PROBING    // G29 P1 probes a coarse grid, then refines only the cells that aren't flat
+  #if ENABLED(UBL_ADAPTIVE_PROBING)
+    #define UBL_ADAPTIVE_STRIDE      3  // Probe every Nth mesh line in the first pass
+    #define UBL_ADAPTIVE_TOLERANCE 0.02 // (mm) Probe a cell fully if its coarse points stray more than this from a local plane
+  #endif
+
+  //#define UBL_BED_TEMP_MESHES     // G29 M1 interpolates the active mesh between meshes saved at different bed temperatures
+  #if ENABLED(UBL_BED_TEMP_MESHES)
+    // Uses a mesh-sized RAM buffer. Mesh edits (M421, G29 J) are replaced by the stored meshes.
+    #define UBL_BED_TEMP_MESH_TEMPS { 60, 80, 100 } // (°C) Bed temperature of the meshes saved in slots 0, 1, 2...
+    #define UBL_BED_TEMP_MESH_STEP  1               // (°C) Bed temperature change that updates the mesh
+  #endif
+
   //#define UBL_TILT_ON_MESH_POINTS         // Use nearest mesh points with G29 J for better Z reference
   //#define UBL_TILT_ON_MESH_POINTS_3POINT  // Use nearest mesh points with G29 J0 (3-point)
 
@@ -405,6 +405,20 @@
     // Keep in mind that some heaters heat up faster than others.
     //#define THERMAL_PROTECTION_VARIANCE_MONITOR_PERIOD 30  // (s) Override all watch periods
   #endif
+
+  /**
+   * Thermal History
+   * Keep a ring buffer of temperature, target, power, and protection state for each
+   * heater, sampled at the sensor reading rate. Use M307 to dump it as text or binary.
+   * With SD support the history is saved to a file when a thermal error halts the
+   * machine, giving real data to tune the THERMAL_PROTECTION_* and WATCH_* periods.
+   */
+  //#define THERMAL_HISTORY
+  #if ENABLED(THERMAL_HISTORY)
+    #define THERMAL_HISTORY_SIZE       64   // Number of samples to keep for each heater
+    #define THERMAL_HISTORY_DIVISOR     1   // Record every Nth sensor reading
+    #define THERMAL_HISTORY_FILE "THERMLOG.BIN" // Saved to the SD root on a thermal error
+  #endif
 #endif
 
 #if ENABLED(PIDTEMP)
@@ -529,6 +543,23 @@
 //#define PREHEAT_TIME_HOTEND_MS 0
 //#define PREHEAT_TIME_BED_MS 0
 
+/**
+ * Predictive Heat-up Wait
+ * Let M109 / M190 return as soon as the heater is predicted to reach its
+ * target within the lead time, so homing, probing, and other moves without
+ * extrusion can run while heating continues. The first extruding move waits
+ * for any deferred heat-up to complete, including TEMP_RESIDENCY_TIME.
+ *
+ * With MPCTEMP the hotend model is used to predict the time-to-target.
+ * Otherwise (and for the bed) the measured rate of rise is used.
+ *
+ * Override the lead time with M109 / M190 L<seconds>. Use L0 to wait normally.
+ */
+//#define PREDICTIVE_HEATUP_WAIT
+#if ENABLED(PREDICTIVE_HEATUP_WAIT)
+  #define PREDICTIVE_HEATUP_LEAD_TIME 60  // (s) Return when the target is predicted to be reached within this time
+#endif
+
 // @section extruder
 
 /**
@@ -1146,6 +1177,9 @@
 
   //#define FT_MOTION_MENU                        // Provide a MarlinUI menu to set M493 parameters
 
+  //#define FTM_LEVELING                          // Apply mesh leveling along each move instead of splitting moves
+                                                  // at mesh lines. (AUTO_BED_LEVELING_BILINEAR or MESH_BED_LEVELING)
+
   /**
    * Advanced configuration
    */
@@ -1727,8 +1761,35 @@
   //#define SD_IGNORE_AT_STARTUP            // Don't mount the SD card when starting up
   //#define SDCARD_READONLY                 // Read-only SD card (to save over 2K of flash)
 
+  // Read the printing file in chunks of whole blocks instead of byte by byte through the
+  // single block cache. Consecutive blocks are fetched with one multi-block read.
+  //#define SD_READ_AHEAD_BLOCKS 4          // Blocks (512 bytes each) of RAM to use. (2..16)
+
+  // Collect M28 upload and M928 log lines in RAM and write them to the file
+  // in whole blocks with one multi-block write, instead of line by line.
+  // Data that has waited for 2 seconds is written out when the machine is idle.
+  //#define SD_WRITE_BUFFER_BLOCKS 4        // Blocks (512 bytes each) of RAM to use. (2..16)
+
   //#define GCODE_REPEAT_MARKERS            // Enable G-code M808 to set repeat markers and do looping
 
+  // Remember where the cluster chain of a large file goes, so seeking (M26, M808 loops,
+  // power-loss resume) doesn't have to follow the chain from the start of the file.
+  // Contiguous files seek instantly, fragmented ones from the nearest checkpoint.
+  //#define SD_SEEK_INDEX_SIZE 32           // Checkpoints (4 bytes each) in the index
+
+  // Remember where each item of the working directory is on the card, so the file browser,
+  // M23 and non-RAM sorting don't rescan the whole directory to find an item.
+  //#define SD_DIR_INDEX_SIZE 128           // Items (4 bytes each) in the index
+
+  // Print G-code files compressed with buildroot/share/scripts/gcode_compress.py.
+  // Compressed files are recognized by their header and decompressed while printing.
+  //#define SD_COMPRESSED_GCODE
+  #if ENABLED(SD_COMPRESSED_GCODE)
+    // Also print binary G-code (.bgcode) with heatshrink 11/4 or 12/4 and MeatPack, checking each block's CRC.
+    // Metadata and thumbnails are available to the UI. Uses about 4K more RAM for the bigger window.
+    //#define SD_BINARY_GCODE
+  #endif
+
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
   #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
@@ -1784,6 +1845,19 @@
       //#define POWER_LOSS_RETRACT_LEN   10 // (mm) Length of filament to retract on fail
     #endif
 
+    // On power-loss save the state to Backup SRAM before writing the SD card. The snapshot
+    // takes microseconds, so resume works with a short hold-up time. Requires a POWER_LOSS_PIN
+    // and a backup battery (VBAT). The snapshot replaces the SD card state on the next boot.
+    //#define POWER_LOSS_SNAPSHOT           // STM32F4/F7 only
+
+    // Between full saves, write small records (SD position, position, temperatures, fans)
+    // to a ring in a preallocated recovery file instead of rewriting it. Writes are spread
+    // over the ring, so the state can be saved every few seconds. Resume uses the newest.
+    //#define POWER_LOSS_JOURNAL 64           // Number of records in the ring
+    #ifdef POWER_LOSS_JOURNAL
+      #define POWER_LOSS_JOURNAL_MS 5000      // (ms) Interval between records while printing
+    #endif
+
     // Enable if Z homing is needed for proper recovery. 99.9% of the time this should be disabled!
     //#define POWER_LOSS_RECOVER_ZHOME
     #if ENABLED(POWER_LOSS_RECOVER_ZHOME)
@@ -1928,6 +2002,16 @@
   #if ENABLED(BINARY_FILE_TRANSFER)
     // Include extra facilities (e.g., 'M20 F') supporting firmware upload via BINARY_FILE_TRANSFER
     //#define CUSTOM_FIRMWARE_UPLOAD
+
+    // Accept heatshrink compressed transfers. Disable to save the decoder's flash and RAM.
+    #define BINARY_STREAM_COMPRESSION
+
+    // Let the host send packets ahead without waiting for each 'ok'. Packets after a lost one
+    // are kept, so only the lost packet is resent. Data is written to the media in whole blocks.
+    //#define BINARY_STREAM_WINDOW 8          // Packets in flight. Must be a power of 2 up to 16.
+    #ifdef BINARY_STREAM_WINDOW
+      #define BINARY_STREAM_PACKET_SIZE 512   // Largest packet payload, in bytes
+    #endif
   #endif
 
   /**
@@ -2414,8 +2498,8 @@
   //#define MESH_MAX_Y Y_BED_SIZE - (MESH_INSET)
 #endif
 
-#if ALL(AUTO_BED_LEVELING_UBL, EEPROM_SETTINGS)
-  //#define OPTIMIZED_MESH_STORAGE  // Store mesh with less precision to save EEPROM space
+#if ANY(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_BILINEAR) && ENABLED(EEPROM_SETTINGS)
+  //#define OPTIMIZED_MESH_STORAGE  // Store mesh Z as 16-bit microns to halve the EEPROM space used
 #endif
 
 /**
@@ -2541,6 +2625,11 @@
  * Preparing your G-code: https://github.com/colinrgodsey/step-daemon
  */
 //#define DIRECT_STEPPING
+#if ENABLED(DIRECT_STEPPING)
+  //#define STEPPER_PAGES 16                  // Number of pages the host can fill ahead
+  //#define STEPPER_PAGE_FORMAT SP_4x2_256    // SP_4x4D_128, SP_4x2_256, SP_4x1_512, or SP_4xND
+  //#define STEPPER_PAGE_SIZE 1024            // (bytes) Page size for SP_4xND, with 4 or 8 bit segments chosen per page
+#endif
 
 /**
  * G38 Probe Target
@@ -2560,6 +2649,22 @@
 // Moves (or segments) with fewer steps than this will be joined with the next move
 #define MIN_STEPS_PER_SEGMENT 6
 
+/**
+ * Adaptive Kinematic Segments
+ *
+ * Vary the length of DELTA, SCARA, and POLAR move segments so the real
+ * path never strays more than a set distance from the straight line.
+ * Regions where the kinematics are nearly linear get fewer, longer blocks.
+ * Segments are never shorter than with DEFAULT_SEGMENTS_PER_SECOND.
+ */
+#if IS_KINEMATIC
+  //#define ADAPTIVE_KINEMATIC_SEGMENTS
+  #if ENABLED(ADAPTIVE_KINEMATIC_SEGMENTS)
+    #define ADAPTIVE_SEGMENT_TOLERANCE  0.01  // (mm) Max distance from the path at the middle of a segment
+    #define ADAPTIVE_SEGMENT_MAX_LENGTH 10    // (mm) Longest allowed segment
+  #endif
+#endif
+
 /**
  * Minimum delay before and after setting the stepper DIR (in ns)
  *     0 : No delay (Expect at least 10µS since one Stepper ISR must transpire)
@@ -3354,6 +3459,13 @@
 
   // @section tmc/status
 
+  /**
+   * Remember the current, stealthChop, hybrid threshold and stallGuard
+   * threshold last sent to each driver and skip writes that change nothing.
+   * Speeds up EEPROM load and M500/M501 with many UART drivers.
+   */
+  //#define TMC_SHADOW_WRITES
+
   /**
    * Monitor Trinamic drivers
    * for error conditions like overtemperature and short to ground.
@@ -3371,6 +3483,8 @@
     #define CURRENT_STEP_DOWN     50  // [mA]
     #define REPORT_CURRENT_CHANGE
     #define STOP_ON_ERROR
+    //#define TMC_STATUS_CACHE        // Read DRV_STATUS one driver at a time between checks and cache it for monitoring and M122.
+                                      // Prevents long main loop stalls with many drivers on a shared UART.
   #endif
 
   // @section tmc/hybrid
@@ -3929,6 +4043,20 @@
   //#define AUTO_REPORT_REDUNDANT // Include the "R" sensor in the auto-report
 #endif
 
+/**
+ * Binary temperature auto-report
+ * A host sends M155 B1 to get compact binary frames on its serial port in place
+ * of the text report. Each frame only includes sensors that changed since the
+ * previous report, with small temperature changes sent as 1-byte deltas.
+ * See Temperature::report_binary for the frame format.
+ */
+#if ENABLED(AUTO_REPORT_TEMPERATURES)
+  //#define AUTO_REPORT_TEMPERATURES_BINARY
+  #if ENABLED(AUTO_REPORT_TEMPERATURES_BINARY)
+    #define AUTO_REPORT_BINARY_KEYFRAME 10  // Send all values every N reports so hosts can resync
+  #endif
+#endif
+
 /**
  * Auto-report position with M154 S<seconds>
  */
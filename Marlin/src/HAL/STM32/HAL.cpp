@@ -77,7 +77,7 @@ void MarlinHAL::init() {
     OUT_WRITE(LED_PIN, LOW);
   #endif
 
-  #if ENABLED(SRAM_EEPROM_EMULATION)
+  #if ANY(SRAM_EEPROM_EMULATION, POWER_LOSS_SNAPSHOT)
     __HAL_RCC_PWR_CLK_ENABLE();
     HAL_PWR_EnableBkUpAccess();           // Enable access to backup SRAM
     __HAL_RCC_BKPSRAM_CLK_ENABLE();
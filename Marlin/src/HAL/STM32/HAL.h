@@ -192,6 +192,16 @@ extern volatile uint32_t systick_uptime_millis;
 
 #define HAL_CAN_SET_PWM_FREQ   // This HAL supports PWM Frequency adjustment
 
+#ifdef BKPSRAM_BASE
+  #define BACKUP_SRAM_ADDR BKPSRAM_BASE
+  #define BACKUP_SRAM_SIZE 0x1000 // 4KB Backup SRAM on STM32F4/F7
+  #if ENABLED(POWER_LOSS_SNAPSHOT)
+    // The last 1KB holds the power-loss snapshot
+    #define SNAPSHOT_SRAM_SIZE 0x400
+    #define SNAPSHOT_SRAM_ADDR (BACKUP_SRAM_ADDR + BACKUP_SRAM_SIZE - SNAPSHOT_SRAM_SIZE)
+  #endif
+#endif
+
 // ------------------------
 // Class Utilities
 // ------------------------
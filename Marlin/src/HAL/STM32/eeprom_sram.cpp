@@ -31,7 +31,10 @@
 #include "../shared/eeprom_api.h"
 
 #ifndef MARLIN_EEPROM_SIZE
-  #define MARLIN_EEPROM_SIZE 0x1000 // 4KB
+  #define MARLIN_EEPROM_SIZE (BACKUP_SRAM_SIZE - TERN0(POWER_LOSS_SNAPSHOT, SNAPSHOT_SRAM_SIZE))
+#endif
+#if ENABLED(POWER_LOSS_SNAPSHOT)
+  static_assert(MARLIN_EEPROM_SIZE <= BACKUP_SRAM_SIZE - SNAPSHOT_SRAM_SIZE, "MARLIN_EEPROM_SIZE overlaps the POWER_LOSS_SNAPSHOT area of Backup SRAM.");
 #endif
 size_t PersistentStore::capacity()    { return MARLIN_EEPROM_SIZE - eeprom_exclude_size; }
 
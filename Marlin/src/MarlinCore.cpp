@@ -785,6 +785,9 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   // Return if setup() isn't completed
   if (marlin_state == MarlinState::MF_INITIALIZING) goto IDLE_DONE;
 
+  // Follow the bed temperature with the stored meshes
+  TERN_(UBL_BED_TEMP_MESHES, bedlevel.update_temp_mesh());
+
   // TODO: Still causing errors
   TERN_(TOOL_SENSOR, (void)check_tool_sensor_stats(active_extruder, true));
 
@@ -814,6 +817,11 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   // Handle SD Card insert / remove
   TERN_(HAS_MEDIA, card.manage_media());
 
+  // Write out buffered SD upload / log data
+  #if HAS_MEDIA && defined(SD_WRITE_BUFFER_BLOCKS)
+    card.idle_flush();
+  #endif
+
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, card.diskIODriver()->idle());
 
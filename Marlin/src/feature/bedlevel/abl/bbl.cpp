@@ -41,8 +41,13 @@ xy_pos_t LevelingBilinear::grid_spacing,
          LevelingBilinear::grid_start;
 xy_float_t LevelingBilinear::grid_factor;
 bed_mesh_t LevelingBilinear::z_values;
-xy_pos_t LevelingBilinear::cached_rel;
-xy_int8_t LevelingBilinear::cached_g;
+
+#if ENABLED(ABL_BILINEAR_COEFFICIENTS)
+  LevelingBilinear::cell_coeff_t LevelingBilinear::cell_coeff[ABL_COEFF_CELLS_X][ABL_COEFF_CELLS_Y];
+#elif DISABLED(ABL_BICUBIC_INTERPOLATION)
+  xy_pos_t LevelingBilinear::cached_rel;
+  xy_int8_t LevelingBilinear::cached_g;
+#endif
 
 /**
  * Extrapolate a single point from its neighbors
@@ -166,13 +171,10 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
   #endif
 }
 
-#if ENABLED(ABL_BILINEAR_SUBDIVISION)
+#if ANY(ABL_BILINEAR_SUBDIVISION, ABL_BICUBIC_INTERPOLATION)
 
   #define ABL_TEMP_POINTS_X (GRID_MAX_POINTS_X + 2)
   #define ABL_TEMP_POINTS_Y (GRID_MAX_POINTS_Y + 2)
-  float LevelingBilinear::z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
-  xy_pos_t LevelingBilinear::grid_spacing_virt;
-  xy_float_t LevelingBilinear::grid_factor_virt;
 
   #define LINEAR_EXTRAPOLATION(E, I) ((E) * 2 - (I))
   float LevelingBilinear::virt_coord(const uint8_t x, const uint8_t y) {
@@ -240,6 +242,14 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
     return virt_cmr(row, 1, tx);
   }
 
+#endif // ABL_BILINEAR_SUBDIVISION || ABL_BICUBIC_INTERPOLATION
+
+#if ENABLED(ABL_BILINEAR_SUBDIVISION)
+
+  float LevelingBilinear::z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+  xy_pos_t LevelingBilinear::grid_spacing_virt;
+  xy_float_t LevelingBilinear::grid_factor_virt;
+
   void LevelingBilinear::subdivide_mesh() {
     grid_spacing_virt = grid_spacing / (BILINEAR_SUBDIVISIONS);
     grid_factor_virt = grid_spacing_virt.reciprocal();
@@ -256,13 +266,6 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
 
 #endif // ABL_BILINEAR_SUBDIVISION
 
-// Refresh after other values have been updated
-void LevelingBilinear::refresh_bed_level() {
-  TERN_(ABL_BILINEAR_SUBDIVISION, subdivide_mesh());
-  cached_rel.x = cached_rel.y = -999.999;
-  cached_g.x = cached_g.y = -99;
-}
-
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
   #define ABL_BG_SPACING(A) grid_spacing_virt.A
   #define ABL_BG_FACTOR(A)  grid_factor_virt.A
@@ -277,6 +280,81 @@ void LevelingBilinear::refresh_bed_level() {
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
+#if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+  #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
+#else
+  #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
+#endif
+
+// Refresh after other values have been updated
+void LevelingBilinear::refresh_bed_level() {
+  TERN_(ABL_BILINEAR_SUBDIVISION, subdivide_mesh());
+  #if ENABLED(ABL_BILINEAR_COEFFICIENTS)
+    calculate_coefficients();
+  #elif DISABLED(ABL_BICUBIC_INTERPOLATION)
+    cached_rel.x = cached_rel.y = -999.999;
+    cached_g.x = cached_g.y = -99;
+  #endif
+}
+
+#if ENABLED(ABL_BICUBIC_INTERPOLATION)
+
+  // Get the Z adjustment from the Catmull-Rom surface through the grid points
+  float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
+    const xy_pos_t rel = raw - grid_start.asFloat(),
+                   ratio = { rel.x * grid_factor.x, rel.y * grid_factor.y };
+
+    const int8_t gx = constrain(FLOOR(ratio.x), 0, GRID_MAX_CELLS_X - 1),
+                 gy = constrain(FLOOR(ratio.y), 0, GRID_MAX_CELLS_Y - 1);
+
+    float u = ratio.x - gx, v = ratio.y - gy;
+    #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+      // Beyond the grid maintain height at grid edges
+      u = constrain(u, 0, 1);
+      v = constrain(v, 0, 1);
+    #endif
+
+    return virt_2cmr(gx + 1, gy + 1, u, v);
+  }
+
+#elif ENABLED(ABL_BILINEAR_COEFFICIENTS)
+
+  void LevelingBilinear::calculate_coefficients() {
+    for (uint8_t x = 0; x < ABL_COEFF_CELLS_X; ++x)
+      for (uint8_t y = 0; y < ABL_COEFF_CELLS_Y; ++y) {
+        const float z00 = ABL_BG_GRID(x, y),     z10 = ABL_BG_GRID(x + 1, y),
+                    z01 = ABL_BG_GRID(x, y + 1), z11 = ABL_BG_GRID(x + 1, y + 1);
+        cell_coeff_t &cc = cell_coeff[x][y];
+        cc.a = z00;
+        cc.b = z10 - z00;
+        cc.c = z01 - z00;
+        cc.d = z11 - z10 - z01 + z00;
+      }
+  }
+
+  // Get the Z adjustment for non-linear bed leveling
+  float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
+    // Grid position relative to the probed area, in cells
+    const xy_pos_t rel = raw - grid_start.asFloat(),
+                   ratio = { rel.x * ABL_BG_FACTOR(x), rel.y * ABL_BG_FACTOR(y) };
+
+    // The last cell also covers the far edge (and beyond, with EXTRAPOLATE_BEYOND_GRID)
+    const int8_t gx = constrain(FLOOR(ratio.x), 0, ABL_COEFF_CELLS_X - 1),
+                 gy = constrain(FLOOR(ratio.y), 0, ABL_COEFF_CELLS_Y - 1);
+
+    float u = ratio.x - gx, v = ratio.y - gy;
+    #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+      // Beyond the grid maintain height at grid edges
+      u = constrain(u, 0, 1);
+      v = constrain(v, 0, 1);
+    #endif
+
+    const cell_coeff_t &cc = cell_coeff[gx][gy];
+    return cc.a + cc.b * u + v * (cc.c + cc.d * u);
+  }
+
+#else // !ABL_BICUBIC_INTERPOLATION && !ABL_BILINEAR_COEFFICIENTS
+
 // Get the Z adjustment for non-linear bed leveling
 float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
@@ -290,12 +368,6 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
   // XY relative to the probed area
   xy_pos_t rel = raw - grid_start.asFloat();
 
-  #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
-    #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
-  #else
-    #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
-  #endif
-
   if (cached_rel.x != rel.x) {
     cached_rel.x = rel.x;
     ratio.x = rel.x * ABL_BG_FACTOR(x);
@@ -361,6 +433,8 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
   return offset;
 }
 
+#endif // !ABL_BICUBIC_INTERPOLATION && !ABL_BILINEAR_COEFFICIENTS
+
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
 
   #define CELL_INDEX(A,V) ((V - grid_start.A) * ABL_BG_FACTOR(A))
@@ -369,7 +443,7 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
    * Prepare a bilinear-leveled linear move on Cartesian,
    * splitting the move where it crosses grid borders.
    */
-  void LevelingBilinear::line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits, uint16_t y_splits) {
+  void LevelingBilinear::line_to_destination(const_feedRate_t scaled_fr_mm_s, grid_lines_t x_splits, grid_lines_t y_splits) {
     // Get current and destination cells for this line
     xy_int_t c1 { CELL_INDEX(x, current_position.x), CELL_INDEX(y, current_position.y) },
              c2 { CELL_INDEX(x, destination.x), CELL_INDEX(y, destination.y) };
@@ -393,18 +467,18 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
     // Crosses on the X and not already split on this X?
     // The x_splits flags are insurance against rounding errors.
-    if (c2.x != c1.x && TEST(x_splits, gc.x)) {
+    if (c2.x != c1.x && (x_splits & (grid_lines_t(1) << gc.x))) {
       // Split on the X grid line
-      CBI(x_splits, gc.x);
+      x_splits &= ~(grid_lines_t(1) << gc.x);
       end = destination;
       destination.x = grid_start.x + ABL_BG_SPACING(x) * gc.x;
       normalized_dist = (destination.x - current_position.x) / (end.x - current_position.x);
       destination.y = LINE_SEGMENT_END(y);
     }
     // Crosses on the Y and not already split on this Y?
-    else if (c2.y != c1.y && TEST(y_splits, gc.y)) {
+    else if (c2.y != c1.y && (y_splits & (grid_lines_t(1) << gc.y))) {
       // Split on the Y grid line
-      CBI(y_splits, gc.y);
+      y_splits &= ~(grid_lines_t(1) << gc.y);
       end = destination;
       destination.y = grid_start.y + ABL_BG_SPACING(y) * gc.y;
       normalized_dist = (destination.y - current_position.y) / (end.y - current_position.y);
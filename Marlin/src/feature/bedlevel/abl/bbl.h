@@ -30,8 +30,6 @@ public:
 
 private:
   static xy_float_t grid_factor;
-  static xy_pos_t cached_rel;
-  static xy_int8_t cached_g;
 
   static void extrapolate_one_point(const uint8_t x, const uint8_t y, const int8_t xdir, const int8_t ydir);
 
@@ -43,10 +41,27 @@ private:
     static xy_pos_t grid_spacing_virt;
     static xy_float_t grid_factor_virt;
 
+    static void subdivide_mesh();
+  #endif
+
+  #if ANY(ABL_BILINEAR_SUBDIVISION, ABL_BICUBIC_INTERPOLATION)
     static float virt_coord(const uint8_t x, const uint8_t y);
     static float virt_cmr(const float p[4], const uint8_t i, const float t);
     static float virt_2cmr(const uint8_t x, const uint8_t y, const_float_t tx, const_float_t ty);
-    static void subdivide_mesh();
+  #endif
+
+  #if ENABLED(ABL_BILINEAR_COEFFICIENTS)
+    #define ABL_COEFF_CELLS_X TERN(ABL_BILINEAR_SUBDIVISION, ABL_GRID_POINTS_VIRT_X - 1, GRID_MAX_CELLS_X)
+    #define ABL_COEFF_CELLS_Y TERN(ABL_BILINEAR_SUBDIVISION, ABL_GRID_POINTS_VIRT_Y - 1, GRID_MAX_CELLS_Y)
+
+    // Z within a cell is a + b * u + c * v + d * u * v for the cell ratios u, v
+    typedef struct { float a, b, c, d; } cell_coeff_t;
+    static cell_coeff_t cell_coeff[ABL_COEFF_CELLS_X][ABL_COEFF_CELLS_Y];
+
+    static void calculate_coefficients();
+  #elif DISABLED(ABL_BICUBIC_INTERPOLATION)
+    static xy_pos_t cached_rel;
+    static xy_int8_t cached_g;
   #endif
 
 public:
@@ -63,7 +78,9 @@ public:
   static constexpr float get_z_offset() { return 0.0f; }
 
   #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
-    static void line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits=0xFFFF, uint16_t y_splits=0xFFFF);
+    // One flag per grid line, to split each line only once
+    typedef bits_t(TERN(ABL_BILINEAR_SUBDIVISION, _MAX(ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y), _MAX(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y))) grid_lines_t;
+    static void line_to_destination(const_feedRate_t scaled_fr_mm_s, grid_lines_t x_splits=grid_lines_t(~0ULL), grid_lines_t y_splits=grid_lines_t(~0ULL));
   #endif
 };
 
@@ -120,6 +120,32 @@ void reset_bed_level() {
   TERN_(ABL_PLANAR, planner.bed_level_matrix.set_to_identity());
 }
 
+#if ENABLED(OPTIMIZED_MESH_STORAGE)
+
+  constexpr float mesh_store_scaling = 1000;
+  constexpr int16_t Z_STEPS_NAN = INT16_MAX;
+
+  void set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values) {
+    auto z_to_store = [](const_float_t z) {
+      if (isnan(z)) return Z_STEPS_NAN;
+      const int32_t z_scaled = TRUNC(z * mesh_store_scaling);
+      if (z_scaled == Z_STEPS_NAN || !WITHIN(z_scaled, INT16_MIN, INT16_MAX))
+        return Z_STEPS_NAN; // If Z is out of range, return our custom 'NaN'
+      return int16_t(z_scaled);
+    };
+    GRID_LOOP(x, y) stored_values[x][y] = z_to_store(in_values[x][y]);
+  }
+
+  float mesh_store_to_z(const int16_t z_scaled) {
+    return z_scaled == Z_STEPS_NAN ? NAN : z_scaled / mesh_store_scaling;
+  }
+
+  void set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values) {
+    GRID_LOOP(x, y) out_values[x][y] = mesh_store_to_z(stored_values[x][y]);
+  }
+
+#endif // OPTIMIZED_MESH_STORAGE
+
 #if ANY(AUTO_BED_LEVELING_BILINEAR, MESH_BED_LEVELING)
 
   /**
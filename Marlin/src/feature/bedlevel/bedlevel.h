@@ -61,6 +61,14 @@ class TemporaryBedLevelingState {
 
   typedef float bed_mesh_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 
+  #if ENABLED(OPTIMIZED_MESH_STORAGE)
+    // Mesh Z in microns, as saved to EEPROM
+    typedef int16_t mesh_store_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+    void set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values);
+    void set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values);
+    float mesh_store_to_z(const int16_t z_scaled);
+  #endif
+
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
     #include "abl/bbl.h"
   #elif ENABLED(AUTO_BED_LEVELING_UBL)
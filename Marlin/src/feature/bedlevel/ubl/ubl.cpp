@@ -97,6 +97,91 @@ void unified_bed_leveling::reset() {
   if (was_enabled) report_current_position();
 }
 
+#if ENABLED(UBL_BED_TEMP_MESHES)
+
+  bool unified_bed_leveling::temp_meshes; // = false
+
+  static constexpr celsius_t mesh_temps[] = UBL_BED_TEMP_MESH_TEMPS;
+  static_assert(COUNT(mesh_temps) >= 2, "UBL_BED_TEMP_MESH_TEMPS needs at least two temperatures.");
+
+  static float temp_mesh_temp,          // Bed temperature of the current interpolation
+               temp_mesh_frac;          // How far z_values lies from the lower to the upper mesh
+  static uint8_t temp_mesh_pair = 0xFF; // Slot of the lower mesh loaded into z_values, 0xFF to reload
+  static bed_mesh_t temp_mesh_diff;     // Upper minus lower mesh of the loaded pair
+
+  // Read one point of a stored mesh without loading the whole slot
+  static float stored_mesh_z(const uint8_t slot, const uint8_t x, const uint8_t y) {
+    TERN(OPTIMIZED_MESH_STORAGE, int16_t, float) z;
+    persistentStore.read_data(settings.mesh_slot_offset(slot) + (x * (GRID_MAX_POINTS_Y) + y) * sizeof(z), (uint8_t*)&z, sizeof(z));
+    return TERN(OPTIMIZED_MESH_STORAGE, mesh_store_to_z(z), z);
+  }
+
+  static bool stored_mesh_complete(const uint8_t slot) {
+    bool complete = true;
+    persistentStore.access_start();
+    GRID_LOOP(x, y) if (complete && isnan(stored_mesh_z(slot, x, y))) complete = false;
+    persistentStore.access_finish();
+    return complete;
+  }
+
+  bool unified_bed_leveling::set_temp_meshes(const bool onoff) {
+    if (onoff) {
+      if (settings.calc_num_meshes() < int16_t(COUNT(mesh_temps))) {
+        SERIAL_ECHOLNPGM("?Bed temperature meshes need ", COUNT(mesh_temps), " storage slots.");
+        return false;
+      }
+      // Check the stored meshes once here so update_temp_mesh() can trust them
+      for (uint8_t s = 0; s < COUNT(mesh_temps); ++s) if (!stored_mesh_complete(s)) {
+        SERIAL_ECHOLNPGM("?Mesh in slot ", s, " is incomplete.");
+        return false;
+      }
+    }
+    temp_meshes = onoff;
+    temp_mesh_pair = 0xFF;
+    return true;
+  }
+
+  /**
+   * Interpolate the active mesh between the two stored meshes whose bed
+   * temperatures (UBL_BED_TEMP_MESH_TEMPS) bracket the current bed temperature.
+   * Beyond the first or last temperature the nearest mesh is used as-is.
+   * Called from idle() so the mesh follows the bed as it heats and cools.
+   *
+   * The two meshes are read from storage only when the bed moves into another
+   * pair. Smaller changes shift z_values along the cached difference. Edits to
+   * the active mesh (M421, G29 J...) are overwritten when a new pair is read or
+   * leveling is turned back on, so save them to the slots instead.
+   */
+  void unified_bed_leveling::update_temp_mesh() {
+    // Not while G29 or anything else is working with leveling off. It may change z_values, so reload after.
+    if (!temp_meshes || !planner.leveling_active) { temp_mesh_pair = 0xFF; return; }
+
+    const float temp = thermalManager.degBed();
+    if (temp_mesh_pair != 0xFF && ABS(temp - temp_mesh_temp) < (UBL_BED_TEMP_MESH_STEP)) return;
+    temp_mesh_temp = temp;
+
+    uint8_t i = 0;
+    while (i < COUNT(mesh_temps) - 2 && temp > mesh_temps[i + 1]) ++i;
+    const float f = constrain((temp - mesh_temps[i]) / float(mesh_temps[i + 1] - mesh_temps[i]), 0.0f, 1.0f);
+
+    if (i != temp_mesh_pair) {
+      temp_mesh_pair = i;
+      persistentStore.access_start();
+      GRID_LOOP(x, y) {
+        const float lower = stored_mesh_z(i, x, y);
+        temp_mesh_diff[x][y] = stored_mesh_z(i + 1, x, y) - lower;
+        z_values[x][y] = lower + temp_mesh_diff[x][y] * f;
+      }
+      persistentStore.access_finish();
+    }
+    else
+      GRID_LOOP(x, y) z_values[x][y] += temp_mesh_diff[x][y] * (f - temp_mesh_frac);
+
+    temp_mesh_frac = f;
+  }
+
+#endif // UBL_BED_TEMP_MESHES
+
 void unified_bed_leveling::invalidate() {
   set_bed_leveling_enabled(false);
   set_all_mesh_points_to_value(NAN);
@@ -109,31 +194,6 @@ void unified_bed_leveling::set_all_mesh_points_to_value(const_float_t value) {
   }
 }
 
-#if ENABLED(OPTIMIZED_MESH_STORAGE)
-
-  constexpr float mesh_store_scaling = 1000;
-  constexpr int16_t Z_STEPS_NAN = INT16_MAX;
-
-  void unified_bed_leveling::set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values) {
-    auto z_to_store = [](const_float_t z) {
-      if (isnan(z)) return Z_STEPS_NAN;
-      const int32_t z_scaled = TRUNC(z * mesh_store_scaling);
-      if (z_scaled == Z_STEPS_NAN || !WITHIN(z_scaled, INT16_MIN, INT16_MAX))
-        return Z_STEPS_NAN; // If Z is out of range, return our custom 'NaN'
-      return int16_t(z_scaled);
-    };
-    GRID_LOOP(x, y) stored_values[x][y] = z_to_store(in_values[x][y]);
-  }
-
-  void unified_bed_leveling::set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values) {
-    auto store_to_z = [](const int16_t z_scaled) {
-      return z_scaled == Z_STEPS_NAN ? NAN : z_scaled / mesh_store_scaling;
-    };
-    GRID_LOOP(x, y) out_values[x][y] = store_to_z(stored_values[x][y]);
-  }
-
-#endif // OPTIMIZED_MESH_STORAGE
-
 static void serial_echo_xy(const uint8_t sp, const int16_t x, const int16_t y) {
   SERIAL_ECHO_SP(sp);
   SERIAL_CHAR('(');
@@ -126,6 +126,10 @@
  *   L #   Load       Load Mesh from the specified location in the EEPROM. Set this location as activated
  *                    for subsequent Load and Store operations.
  *
+ *   M #   Meshes     With UBL_BED_TEMP_MESHES, M1 makes the active mesh follow the bed temperature by
+ *                    interpolating between the meshes stored in slots 0, 1, 2... which were probed at the
+ *                    temperatures in UBL_BED_TEMP_MESH_TEMPS. M0 turns this off.
+ *
  *   The P or Phase commands are used for the bulk of the work to setup a Mesh. In general, your Mesh will
  *   start off being initialized with a G29 P0 or a G29 P1. Further refinement of the Mesh happens with
  *   each additional Phase that processes it.
@@ -640,6 +644,16 @@ void unified_bed_leveling::G29() {
     SERIAL_ECHOLNPGM(STR_DONE);
   }
 
+  #if ENABLED(UBL_BED_TEMP_MESHES)
+    //
+    // Follow the bed temperature with the stored meshes
+    //
+    if (parser.seen('M')) {
+      if (!set_temp_meshes(parser.value_bool())) return;
+      SERIAL_ECHOLNPGM("Bed temperature meshes ", temp_meshes ? F("on") : F("off"));
+    }
+  #endif
+
   //
   // Store a Mesh in the EEPROM
   //
@@ -744,6 +758,117 @@ void unified_bed_leveling::shift_mesh_height() {
 }
 
 #if HAS_BED_PROBE
+
+  #ifndef HUGE_VALF
+    #define HUGE_VALF __FLT_MAX__
+  #endif
+
+  #if ENABLED(UBL_ADAPTIVE_PROBING)
+
+    /**
+     * Adaptive probing for G29 P1. The first pass probes only every UBL_ADAPTIVE_STRIDE'th mesh
+     * line (plus the last) and leaves the points in between pending. A plane is fit to the coarse
+     * points in and around each coarse cell, and a cell whose points stray from it by more than
+     * UBL_ADAPTIVE_TOLERANCE gets its pending points probed in a second pass. Pending points that
+     * remain after that are interpolated from the corners of their cell.
+     */
+    #define ADAPTIVE_PENDING (-HUGE_VALF)
+
+    static bool is_coarse(const uint8_t i, const uint8_t n) { return i % (UBL_ADAPTIVE_STRIDE) == 0 || i == n - 1; }
+    static uint8_t coarse_floor(const uint8_t i) { return i - i % (UBL_ADAPTIVE_STRIDE); }
+    static uint8_t coarse_next(const uint8_t i, const uint8_t n) { return _MIN(coarse_floor(i) + (UBL_ADAPTIVE_STRIDE), n - 1); }
+
+    // A real measurement, as opposed to NAN, a failed probe (HUGE_VALF) or a pending point
+    static bool is_probed(const_float_t z) { return !isnan(z) && ABS(z) != HUGE_VALF; }
+
+    static void adaptive_mark_pending() {
+      GRID_LOOP(x, y)
+        if (isnan(bedlevel.z_values[x][y]) && !(is_coarse(x, GRID_MAX_POINTS_X) && is_coarse(y, GRID_MAX_POINTS_Y)))
+          bedlevel.z_values[x][y] = ADAPTIVE_PENDING;
+    }
+
+    #if HAS_MARLINUI_MENU
+      static void adaptive_clear_pending() {
+        GRID_LOOP(x, y) if (bedlevel.z_values[x][y] == ADAPTIVE_PENDING) bedlevel.z_values[x][y] = NAN;
+      }
+    #endif
+
+    // Release the pending points of every coarse cell that isn't flat enough to interpolate
+    static void adaptive_refine_cells() {
+      for (uint8_t x0 = 0; x0 < (GRID_MAX_POINTS_X) - 1; x0 = coarse_next(x0, GRID_MAX_POINTS_X)) {
+        const uint8_t x1 = coarse_next(x0, GRID_MAX_POINTS_X),
+                      xa = x0 ? coarse_floor(x0 - 1) : 0, xb = coarse_next(x1, GRID_MAX_POINTS_X);
+        for (uint8_t y0 = 0; y0 < (GRID_MAX_POINTS_Y) - 1; y0 = coarse_next(y0, GRID_MAX_POINTS_Y)) {
+          const uint8_t y1 = coarse_next(y0, GRID_MAX_POINTS_Y),
+                        ya = y0 ? coarse_floor(y0 - 1) : 0, yb = coarse_next(y1, GRID_MAX_POINTS_Y);
+
+          bool refine = !( is_probed(bedlevel.z_values[x0][y0]) && is_probed(bedlevel.z_values[x1][y0])
+                        && is_probed(bedlevel.z_values[x0][y1]) && is_probed(bedlevel.z_values[x1][y1]) );
+
+          if (!refine) {
+            // Fit a plane to the coarse points of this cell and its neighbors
+            struct linear_fit_data lsf_results;
+            incremental_LSF_reset(&lsf_results);
+            for (uint8_t i = xa;; i = coarse_next(i, GRID_MAX_POINTS_X)) {
+              for (uint8_t j = ya;; j = coarse_next(j, GRID_MAX_POINTS_Y)) {
+                if (is_probed(bedlevel.z_values[i][j]))
+                  incremental_LSF(&lsf_results, bedlevel.get_mesh_x(i), bedlevel.get_mesh_y(j), bedlevel.z_values[i][j]);
+                if (j == yb) break;
+              }
+              if (i == xb) break;
+            }
+
+            refine = finish_incremental_LSF(&lsf_results);
+
+            // Refine if any coarse point strays too far from the plane
+            for (uint8_t i = xa; !refine; i = coarse_next(i, GRID_MAX_POINTS_X)) {
+              for (uint8_t j = ya; !refine; j = coarse_next(j, GRID_MAX_POINTS_Y)) {
+                const float z = bedlevel.z_values[i][j];
+                if (is_probed(z)) {
+                  const float ez = -lsf_results.D - lsf_results.A * bedlevel.get_mesh_x(i) - lsf_results.B * bedlevel.get_mesh_y(j);
+                  refine = ABS(z - ez) > (UBL_ADAPTIVE_TOLERANCE);
+                }
+                if (j == yb) break;
+              }
+              if (i == xb) break;
+            }
+          }
+
+          if (refine)
+            for (uint8_t i = x0; i <= x1; ++i)
+              for (uint8_t j = y0; j <= y1; ++j)
+                if (bedlevel.z_values[i][j] == ADAPTIVE_PENDING) bedlevel.z_values[i][j] = NAN;
+        }
+      }
+    }
+
+    // Interpolate the remaining pending points from the corners of their coarse cell
+    static grid_count_t adaptive_fill_pending() {
+      grid_count_t filled = 0;
+      GRID_LOOP(x, y) {
+        float &z = bedlevel.z_values[x][y];
+        if (z != ADAPTIVE_PENDING) continue;
+        const uint8_t x0 = coarse_floor(x), x1 = coarse_next(x0, GRID_MAX_POINTS_X),
+                      y0 = coarse_floor(y), y1 = coarse_next(y0, GRID_MAX_POINTS_Y);
+        const float z00 = bedlevel.z_values[x0][y0], z10 = bedlevel.z_values[x1][y0],
+                    z01 = bedlevel.z_values[x0][y1], z11 = bedlevel.z_values[x1][y1];
+        if (is_probed(z00) && is_probed(z10) && is_probed(z01) && is_probed(z11)) {
+          const float fx = x1 > x0 ? float(x - x0) / (x1 - x0) : 0.0f,
+                      fy = y1 > y0 ? float(y - y0) / (y1 - y0) : 0.0f,
+                      z0 = z00 + (z10 - z00) * fx,
+                      z1 = z01 + (z11 - z01) * fx;
+          z = z0 + (z1 - z0) * fy;
+          ++filled;
+        }
+        else
+          z = NAN;
+        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z));
+      }
+      return filled;
+    }
+
+  #endif // UBL_ADAPTIVE_PROBING
+
   /**
    * G29 P1 T<maptype> V<verbosity> : Probe Entire Mesh
    *   Probe all invalidated locations of the mesh that can be reached by the probe.
@@ -760,46 +885,59 @@ void unified_bed_leveling::shift_mesh_height() {
 
     mesh_index_pair best;
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_START));
-    do {
-      if (do_ubl_mesh_map) display_map(param.T_map_type);
 
-      const grid_count_t point_num = (GRID_MAX_POINTS - count) + 1;
-      SERIAL_ECHOLNPGM("Probing mesh point ", point_num, "/", GRID_MAX_POINTS, ".");
-      TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT_F(MSG_PROBING_POINT), point_num, int(GRID_MAX_POINTS)));
-      TERN_(HAS_BACKLIGHT_TIMEOUT, ui.refresh_backlight_timeout());
+    #if ENABLED(UBL_ADAPTIVE_PROBING)
+      adaptive_mark_pending();
+      constexpr uint8_t passes = 2;
+    #else
+      constexpr uint8_t passes = 1;
+    #endif
 
-      #if HAS_MARLINUI_MENU
-        if (ui.button_pressed()) {
-          ui.quick_feedback(false); // Preserve button state for click-and-hold
-          SERIAL_ECHOLNPGM("\nMesh only partially populated.\n");
-          ui.wait_for_release();
-          ui.quick_feedback();
-          ui.release();
-          probe.stow(); // Release UI before stow to allow for PAUSE_BEFORE_DEPLOY_STOW
-          return restore_ubl_active_state();
-        }
-      #endif
+    for (uint8_t pass = 0; pass < passes; ++pass) {
+      TERN_(UBL_ADAPTIVE_PROBING, if (pass) adaptive_refine_cells());
 
-      #ifndef HUGE_VALF
-        #define HUGE_VALF __FLT_MAX__
-      #endif
+      do {
+        if (do_ubl_mesh_map) display_map(param.T_map_type);
+
+        const grid_count_t point_num = (GRID_MAX_POINTS - count) + 1;
+        SERIAL_ECHOLNPGM("Probing mesh point ", point_num, "/", GRID_MAX_POINTS, ".");
+        TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT_F(MSG_PROBING_POINT), point_num, int(GRID_MAX_POINTS)));
+        TERN_(HAS_BACKLIGHT_TIMEOUT, ui.refresh_backlight_timeout());
 
-      best = do_furthest // Points with valid data or HUGE_VALF are skipped
-        ? find_furthest_invalid_mesh_point()
-        : find_closest_mesh_point_of_type(INVALID, nearby, true);
-
-      if (best.pos.x >= 0) {    // mesh point found and is reachable by probe
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_POINT_START));
-        const float measured_z = probe.probe_at_point(best.meshpos(), stow_probe ? PROBE_PT_STOW : PROBE_PT_RAISE, param.V_verbosity);
-        z_values[best.pos.x][best.pos.y] = isnan(measured_z) ? HUGE_VALF : measured_z;  // Mark invalid point already probed with HUGE_VALF to omit it in the next loop
-        #if ENABLED(EXTENSIBLE_UI)
-          ExtUI::onMeshUpdate(best.pos, ExtUI::G29_POINT_FINISH);
-          ExtUI::onMeshUpdate(best.pos, measured_z);
+        #if HAS_MARLINUI_MENU
+          if (ui.button_pressed()) {
+            ui.quick_feedback(false); // Preserve button state for click-and-hold
+            SERIAL_ECHOLNPGM("\nMesh only partially populated.\n");
+            ui.wait_for_release();
+            ui.quick_feedback();
+            ui.release();
+            TERN_(UBL_ADAPTIVE_PROBING, adaptive_clear_pending());
+            probe.stow(); // Release UI before stow to allow for PAUSE_BEFORE_DEPLOY_STOW
+            return restore_ubl_active_state();
+          }
         #endif
-      }
-      SERIAL_FLUSH(); // Prevent host M105 buffer overrun.
 
-    } while (best.pos.x >= 0 && --count);
+        best = do_furthest // Points with valid data or HUGE_VALF are skipped
+          ? find_furthest_invalid_mesh_point()
+          : find_closest_mesh_point_of_type(INVALID, nearby, true);
+
+        if (best.pos.x >= 0) {    // mesh point found and is reachable by probe
+          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_POINT_START));
+          const float measured_z = probe.probe_at_point(best.meshpos(), stow_probe ? PROBE_PT_STOW : PROBE_PT_RAISE, param.V_verbosity);
+          z_values[best.pos.x][best.pos.y] = isnan(measured_z) ? HUGE_VALF : measured_z;  // Mark invalid point already probed with HUGE_VALF to omit it in the next loop
+          #if ENABLED(EXTENSIBLE_UI)
+            ExtUI::onMeshUpdate(best.pos, ExtUI::G29_POINT_FINISH);
+            ExtUI::onMeshUpdate(best.pos, measured_z);
+          #endif
+        }
+        SERIAL_FLUSH(); // Prevent host M105 buffer overrun.
+
+      } while (best.pos.x >= 0 && --count);
+    }
+
+    #if ENABLED(UBL_ADAPTIVE_PROBING)
+      SERIAL_ECHOLNPGM("Interpolated ", adaptive_fill_pending(), " mesh points.");
+    #endif
 
     GRID_LOOP(x, y) if (z_values[x][y] == HUGE_VALF) z_values[x][y] = NAN; // Restore NAN for HUGE_VALF marks
 
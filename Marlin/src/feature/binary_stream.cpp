@@ -33,4 +33,9 @@ bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_tran
 
 BinaryStream binaryStream[NUM_SERIAL];
 
+#ifdef BINARY_STREAM_WINDOW
+  BinaryStream::Packet::Header BinaryStream::held_header[BINARY_STREAM_WINDOW];
+  char BinaryStream::slot_buffer[BINARY_STREAM_WINDOW][BINARY_STREAM_PACKET_SIZE];
+#endif
+
 #endif
@@ -23,12 +23,13 @@
 
 #include "../inc/MarlinConfig.h"
 
-#define BINARY_STREAM_COMPRESSION
 #if ENABLED(BINARY_STREAM_COMPRESSION)
   #include "../libs/heatshrink/heatshrink_decoder.h"
+  static heatshrink_decoder hsd;
+#endif
+#if ENABLED(BINARY_STREAM_COMPRESSION) || defined(BINARY_STREAM_WINDOW)
   // STM32 (and others?) require a word-aligned buffer for SD card transfers via DMA
   static __attribute__((aligned(sizeof(size_t)))) uint8_t decode_buffer[512] = {};
-  static heatshrink_decoder hsd;
 #endif
 
 inline bool bs_serial_data_available(const serial_index_t index) {
@@ -95,12 +96,27 @@ private:
         return true;
       }
     #endif
-    return (dummy_transfer || card.write(buffer, length) >= 0);
+    #ifdef BINARY_STREAM_WINDOW
+      // Stage the data and only write whole blocks to the media
+      for (size_t done = 0; done < length;) {
+        const size_t count = _MIN(length - done, sizeof(decode_buffer) - data_waiting);
+        memcpy(&decode_buffer[data_waiting], &buffer[done], count);
+        data_waiting += count;
+        done += count;
+        if (data_waiting == sizeof(decode_buffer)) {
+          if (!dummy_transfer && card.write(decode_buffer, data_waiting) < 0) return false;
+          data_waiting = 0;
+        }
+      }
+      return true;
+    #else
+      return (dummy_transfer || card.write(buffer, length) >= 0);
+    #endif
   }
 
   static bool file_close() {
     if (!dummy_transfer) {
-      #if ENABLED(BINARY_STREAM_COMPRESSION)
+      #if ENABLED(BINARY_STREAM_COMPRESSION) || defined(BINARY_STREAM_WINDOW)
         // flush any buffered data
         if (data_waiting) {
           if (card.write(decode_buffer, data_waiting) < 0) return false;
@@ -161,7 +177,8 @@ public:
             auto packet = Packet::Open::decode(buffer);
             compression = packet.compression_enabled();
             dummy_transfer = packet.dummy_transfer();
-            if (file_open(packet.filename())) {
+            // A compressed transfer can't be written without the decoder
+            if ((ENABLED(BINARY_STREAM_COMPRESSION) || !compression) && file_open(packet.filename())) {
               SERIAL_ECHOLNPGM("PFT:success");
               break;
             }
@@ -201,7 +218,7 @@ class BinaryStream {
 public:
   enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER };
 
-  enum class ProtocolControl : uint8_t { SYNC = 1, CLOSE };
+  enum class ProtocolControl : uint8_t { SYNC = 1, CLOSE, WINDOW };
 
   enum class StreamState : uint8_t { PACKET_RESET, PACKET_WAIT, PACKET_HEADER, PACKET_DATA, PACKET_FOOTER,
                                      PACKET_PROCESS, PACKET_RESEND, PACKET_TIMEOUT, PACKET_ERROR };
@@ -254,8 +271,66 @@ public:
     sync = 0;
     packet_retries = 0;
     buffer_next_index = 0;
+    TERN_(BINARY_STREAM_WINDOW, set_window(0));
   }
 
+  #ifdef BINARY_STREAM_WINDOW
+    // Use the largest power of 2 that fits the request, so slots don't collide when sync wraps
+    void set_window(uint8_t size) {
+      NOMORE(size, BINARY_STREAM_WINDOW);
+      while (size & (size - 1)) size &= size - 1;
+      window = size;
+      held = 0;
+      nak_sent = false;
+    }
+
+    // Take a packet into its slot, even when earlier packets are still missing
+    void accept_windowed() {
+      const uint8_t ahead = packet.header.sync - sync, slot = packet.header.sync & (window - 1);
+      if (ahead >= window) {                      // Already processed, so the ok response must have been lost
+        SERIAL_ECHOLNPGM("ok", uint8_t(sync - 1));
+        stream_state = StreamState::PACKET_RESET;
+        return;
+      }
+      if (TEST(held, slot)) {                     // A copy is already waiting
+        stream_state = StreamState::PACKET_RESET;
+        return;
+      }
+      if (ahead && !nak_sent) {                   // Ask once for the first missing packet, keep the rest
+        SERIAL_ECHOLNPGM("rs", sync);
+        nak_sent = true;
+      }
+      buffer_next_index = 0;
+      packet.bytes_received = 0;
+      packet.buffer = slot_buffer[slot];
+      stream_state = packet.header.size ? StreamState::PACKET_DATA : StreamState::PACKET_PROCESS;
+    }
+
+    // Hold a packet received ahead of sync, or process it along with any held packets that follow it
+    void process_windowed() {
+      uint8_t slot = packet.header.sync & (window - 1);
+      if (packet.header.sync != sync) {
+        held_header[slot] = packet.header;
+        SBI(held, slot);
+        return;
+      }
+      packet_retries = 0;
+      nak_sent = false;
+      for (;;) {
+        bytes_received += packet.header.size;
+        dispatch();
+        sync++;
+        if (!window) break;                       // Closed, back to stop-and-wait
+        slot = sync & (window - 1);
+        if (!TEST(held, slot)) break;
+        CBI(held, slot);
+        packet.header = held_header[slot];
+        packet.buffer = slot_buffer[slot];
+      }
+      SERIAL_ECHOLNPGM("ok", uint8_t(sync - 1));  // Acknowledge everything up to here
+    }
+  #endif
+
   // fletchers 16 checksum
   uint32_t checksum(uint32_t cs, uint8_t value) {
     uint16_t cs_low = (((cs & 0xFF) + value) % 255);
@@ -326,6 +401,9 @@ public:
                   stream_state = StreamState::PACKET_RESET;
                   break;
               }
+              #ifdef BINARY_STREAM_WINDOW
+                if (window) { accept_windowed(); break; }
+              #endif
               if (packet.header.sync == sync) {
                 buffer_next_index = 0;
                 packet.bytes_received = 0;
@@ -357,7 +435,7 @@ public:
         case StreamState::PACKET_DATA:
           if (!stream_read(data)) break;
 
-          if (buffer_next_index < buffer_size)
+          if (buffer_next_index < TERN(BINARY_STREAM_WINDOW, (window ? BINARY_STREAM_PACKET_SIZE : buffer_size), buffer_size))
             packet.buffer[buffer_next_index] = data;
           else {
             SERIAL_ECHO_MSG("Datastream packet data buffer overrun");
@@ -384,11 +462,25 @@ public:
             }
             else {
               SERIAL_ECHO_MSG("Packet(", packet.header.sync, ") payload corrupt");
+              #ifdef BINARY_STREAM_WINDOW
+                if (window) {                     // The header is good, so ask for just this packet
+                  SERIAL_ECHOLNPGM("rs", packet.header.sync);
+                  stream_state = StreamState::PACKET_RESET;
+                  break;
+                }
+              #endif
               stream_state = StreamState::PACKET_RESEND;
             }
           }
           break;
         case StreamState::PACKET_PROCESS:
+          #ifdef BINARY_STREAM_WINDOW
+            if (window) {
+              process_windowed();
+              stream_state = StreamState::PACKET_RESET;
+              break;
+            }
+          #endif
           sync++;
           packet_retries = 0;
           bytes_received += packet.header.size;
@@ -428,6 +520,15 @@ public:
         switch (static_cast<ProtocolControl>(packet.header.type())) {
           case ProtocolControl::CLOSE: // revert back to ASCII mode
             card.flag.binary_mode = false;
+            TERN_(BINARY_STREAM_WINDOW, set_window(0));
+            break;
+          case ProtocolControl::WINDOW: // host asks to send packets ahead, reply with the window and packet size allowed
+            #ifdef BINARY_STREAM_WINDOW
+              set_window(packet.header.size ? uint8_t(packet.buffer[0]) : 0);
+              SERIAL_ECHOLN(F("sw"), window, C(','), BINARY_STREAM_PACKET_SIZE);
+            #else
+              SERIAL_ECHOLNPGM("sw0");
+            #endif
             break;
           default:
             SERIAL_ECHO_MSG("Unknown BinaryProtocolControl Packet");
@@ -451,6 +552,15 @@ public:
   uint16_t buffer_next_index;
   uint32_t bytes_received;
   StreamState stream_state = StreamState::PACKET_RESET;
+
+  #ifdef BINARY_STREAM_WINDOW
+    uint8_t window;                             // Negotiated window, 0 for stop-and-wait
+    uint16_t held;                              // Slots holding a packet received ahead of sync
+    bool nak_sent;                              // Resend of the sync packet already requested
+    // Only one port transfers at a time, so the slots are shared
+    static Packet::Header held_header[BINARY_STREAM_WINDOW];
+    static char slot_buffer[BINARY_STREAM_WINDOW][BINARY_STREAM_PACKET_SIZE];
+  #endif
 };
 
 extern BinaryStream binaryStream[NUM_SERIAL];
@@ -72,6 +72,15 @@ namespace DirectStepping {
   template<typename Cfg>
   typename Cfg::write_byte_idx_t SerialPageManager<Cfg>::write_page_size;
 
+  template<typename Cfg>
+  uint8_t SerialPageManager<Cfg>::page_bits[Cfg::VARIABLE ? Cfg::PAGE_COUNT : 1];
+
+  template<typename Cfg>
+  uint16_t SerialPageManager<Cfg>::page_segments[Cfg::VARIABLE ? Cfg::PAGE_COUNT : 1];
+
+  template<typename Cfg>
+  uint8_t SerialPageManager<Cfg>::write_page_bits;
+
   template <typename Cfg>
   void SerialPageManager<Cfg>::init() {
     for (int i = 0 ; i < Cfg::PAGE_COUNT ; i++)
@@ -126,20 +135,51 @@ namespace DirectStepping {
 
         set_page_state(write_page_idx, PageState::WRITING);
 
-        state = Cfg::DIRECTIONAL ? State::COLLECT : State::SIZE;
+        state = Cfg::VARIABLE ? State::FORMAT : Cfg::DIRECTIONAL ? State::COLLECT : State::SIZE;
 
+        return true;
+      case State::FORMAT:
+        // Bits per axis in each segment
+        write_page_bits = c;
+        if (c != 4 && c != 8) {
+          fatal_error = true;
+          state = State::MONITOR;
+          return true;
+        }
+        state = State::SIZE;
         return true;
       case State::SIZE:
         // Zero means full page size
         write_page_size = c;
+        state = Cfg::VARIABLE ? State::SIZE_HIGH : State::COLLECT;
+        return true;
+      case State::SIZE_HIGH: {
+        write_page_size = write_byte_idx_t(write_page_size | (uint16_t(c) << 8));
+        if (!write_page_size) write_page_size = Cfg::PAGE_SIZE;
+
+        // Whole segments of 4 axes that fit in the page
+        const uint8_t segment_bytes = write_page_bits / 2;
+        if (!segment_bytes || write_page_size > Cfg::PAGE_SIZE || write_page_size % segment_bytes) {
+          fatal_error = true;
+          state = State::MONITOR;
+          return true;
+        }
+        page_bits[write_page_idx] = write_page_bits;
+        page_segments[write_page_idx] = write_page_size / segment_bytes;
+
         state = State::COLLECT;
         return true;
+      }
       case State::COLLECT:
         pages[write_page_idx][write_byte_idx++] = c;
         checksum ^= c;
 
         // check if still collecting
-        if (Cfg::PAGE_SIZE == 256) {
+        if (Cfg::VARIABLE) {
+          if (write_byte_idx < write_page_size)
+            return true;
+        }
+        else if (Cfg::PAGE_SIZE == 256) {
           // special case for 8-bit, check if rolled back to 0
           if (Cfg::DIRECTIONAL || !write_page_size) { // full 256 bytes
             if (write_byte_idx) return true;
@@ -172,6 +212,37 @@ namespace DirectStepping {
     }
   }
 
+  template <typename Cfg>
+  uint8_t *SerialPageManager<Cfg>::claim_rx_span(uint16_t &len) {
+    if (state != State::COLLECT) return nullptr;
+    len = rx_page_end() - write_byte_idx;
+    return &pages[write_page_idx][write_byte_idx];
+  }
+
+  template <typename Cfg>
+  void SerialPageManager<Cfg>::commit_rx_span(const uint16_t len) {
+    const uint8_t *data = &pages[write_page_idx][write_byte_idx];
+    for (uint16_t i = 0; i < len; ++i) checksum ^= data[i];
+
+    const uint16_t end = write_byte_idx + len;
+    write_byte_idx = end;                   // Wraps to 0 for a full 256-byte page
+    if (end >= rx_page_end()) state = State::CHECKSUM;
+  }
+
+  template <typename Cfg>
+  uint8_t SerialPageManager<Cfg>::get_page_bits(const page_idx_t page_idx) {
+    CHECK_PAGE(page_idx, 0);
+    return Cfg::VARIABLE ? page_bits[Cfg::VARIABLE ? page_idx : 0] : Cfg::BITS_SEGMENT;
+  }
+
+  template <typename Cfg>
+  uint32_t SerialPageManager<Cfg>::get_page_steps(const page_idx_t page_idx) {
+    CHECK_PAGE(page_idx, 0);
+    if (!Cfg::VARIABLE) return Cfg::TOTAL_STEPS;
+    const page_idx_t i = Cfg::VARIABLE ? page_idx : 0;
+    return uint32_t(page_segments[i]) * (page_bits[i] == 8 ? 127 : Cfg::SEGMENT_STEPS);
+  }
+
   template <typename Cfg>
   void SerialPageManager<Cfg>::write_responses() {
     if (fatal_error) {
@@ -227,7 +298,7 @@ DirectStepping::PageManager page_manager;
 
 const uint8_t segment_table[DirectStepping::Config::NUM_SEGMENTS][DirectStepping::Config::SEGMENT_STEPS] PROGMEM = {
 
-  #if STEPPER_PAGE_FORMAT == SP_4x4D_128
+  #if STEPPER_PAGE_FORMAT == SP_4x4D_128 || STEPPER_PAGE_FORMAT == SP_4xND
 
     { 1, 1, 1, 1, 1, 1, 1 }, //  0 = -7
     { 1, 1, 1, 0, 1, 1, 1 }, //  1 = -6
@@ -26,7 +26,7 @@
 namespace DirectStepping {
 
   enum State : char {
-    MONITOR, NEWLINE, ADDRESS, SIZE, COLLECT, CHECKSUM, UNFAIL
+    MONITOR, NEWLINE, ADDRESS, FORMAT, SIZE, SIZE_HIGH, COLLECT, CHECKSUM, UNFAIL
   };
 
   enum PageState : uint8_t {
@@ -45,6 +45,11 @@ namespace DirectStepping {
     xyze_uint8_t sd;
     // Block delta
     xyze_int_t bd;
+    // SP_4xND page segment bits and directions (bits 3..0 for X, Y, Z, E)
+    uint8_t bits, dir;
+    // SP_4xND segment steps, step accumulators, and block deltas for X, Y, Z, E
+    uint8_t seg[4], acc[4];
+    int32_t delta[4];
   };
 
   template<typename Cfg>
@@ -56,6 +61,17 @@ namespace DirectStepping {
     static bool maybe_store_rxd_char(uint8_t c);
     static void write_responses();
 
+    // A page header or page data is being received
+    static bool receiving() { return state != State::MONITOR && state != State::NEWLINE; }
+
+    // Let a receiver fill the body of the page being written in place (e.g., by DMA)
+    static uint8_t *claim_rx_span(uint16_t &len);
+    static void commit_rx_span(const uint16_t len);
+
+    // Segment bits and total steps of a received page
+    static uint8_t get_page_bits(const page_idx_t page_idx);
+    static uint32_t get_page_steps(const page_idx_t page_idx);
+
     // common methods for page managers
     static void init();
     static uint8_t *get_page(const page_idx_t page_idx);
@@ -77,12 +93,22 @@ namespace DirectStepping {
     static page_idx_t write_page_idx;
     static write_byte_idx_t write_page_size;
 
+    // Per-page segment bits and segment counts for SP_4xND
+    static uint8_t page_bits[Cfg::VARIABLE ? Cfg::PAGE_COUNT : 1];
+    static uint16_t page_segments[Cfg::VARIABLE ? Cfg::PAGE_COUNT : 1];
+    static uint8_t write_page_bits;
+
+    static uint16_t rx_page_end() {
+      return ((Cfg::DIRECTIONAL && !Cfg::VARIABLE) || !write_page_size) ? Cfg::PAGE_SIZE : write_page_size;
+    }
+
     static void set_page_state(const page_idx_t page_idx, const PageState page_state);
   };
 
-  template <int num_pages, int num_axes, int bits_segment, bool dir, int segments>
+  template <int num_pages, int num_axes, int bits_segment, bool dir, int segments, bool variable=false>
   struct config_t {
     static constexpr char CONTROL_CHAR  = '!';
+    static constexpr bool VARIABLE      = variable;
 
     static constexpr int PAGE_COUNT     = num_pages;
     static constexpr int AXIS_COUNT     = num_axes;
@@ -108,6 +134,11 @@ namespace DirectStepping {
   template <uint8_t num_pages>
   using SP_4x1_512  = config_t<num_pages, 4, 1, false, 512>;
 
+  // Large pages with a format byte and 16-bit size in the page header.
+  // Each page holds 4 bit (as SP_4x4D_128) or 8 bit (signed steps over 127 ticks) segments.
+  template <uint8_t num_pages>
+  using SP_4xND     = config_t<num_pages, 4, 4, true, (STEPPER_PAGE_SIZE) / 2, true>;
+
   // configured types
   typedef STEPPER_PAGE_FORMAT<STEPPER_PAGES> Config;
 
@@ -120,6 +151,7 @@ namespace DirectStepping {
 //#define SP_4x2D_256 3
 #define SP_4x2_256 4
 #define SP_4x1_512 5
+#define SP_4xND 6
 
 typedef typename DirectStepping::Config::page_idx_t page_idx_t;
 
@@ -128,3 +160,50 @@ typedef DirectStepping::page_step_state_t page_step_state_t;
 
 extern const uint8_t segment_table[DirectStepping::Config::NUM_SEGMENTS][DirectStepping::Config::SEGMENT_STEPS];
 extern DirectStepping::PageManager page_manager;
+
+#if STEPPER_PAGE_FORMAT == SP_4xND
+
+  namespace DirectStepping {
+
+    /**
+     * Get the steps for the next tick of a SP_4xND page as bits 3..0 for X, Y, Z, E.
+     * Directions are updated in ps.dir when a segment is loaded, for axes that move.
+     */
+    FORCE_INLINE uint8_t page_step_bits(page_step_state_t &ps) {
+      uint8_t steps = 0;
+      if (ps.bits == 8) {
+        if (ps.segment_steps == 0) {
+          for (uint8_t i = 0; i < 4; ++i) {
+            // A segment has 127 ticks, so -128 is taken as -127 to keep the position in step
+            const int8_t v = _MAX(int8_t(ps.page[ps.segment_idx + i]), int8_t(-127));
+            ps.seg[i] = ABS(v);
+            ps.acc[i] = 63;                 // Center the steps within the segment
+            ps.delta[i] += v;
+            if (v) SET_BIT_TO(ps.dir, 3 - i, v > 0);
+          }
+        }
+        for (uint8_t i = 0; i < 4; ++i) {
+          ps.acc[i] += ps.seg[i];
+          if (ps.acc[i] >= 127) { ps.acc[i] -= 127; SBI(steps, 3 - i); }
+        }
+        if (++ps.segment_steps == 127) { ps.segment_steps = 0; ps.segment_idx += 4; }
+      }
+      else {
+        if (ps.segment_steps == 0) {
+          const uint8_t low = ps.page[ps.segment_idx], high = ps.page[ps.segment_idx + 1];
+          ps.seg[0] = low >> 4; ps.seg[1] = low & 0xF; ps.seg[2] = high >> 4; ps.seg[3] = high & 0xF;
+          for (uint8_t i = 0; i < 4; ++i) {
+            ps.delta[i] += ps.seg[i] - 7;
+            if (ps.seg[i] != 7) SET_BIT_TO(ps.dir, 3 - i, ps.seg[i] > 7);
+          }
+        }
+        for (uint8_t i = 0; i < 4; ++i)
+          if (pgm_read_byte(&segment_table[ps.seg[i]][ps.segment_steps])) SBI(steps, 3 - i);
+        if (++ps.segment_steps == Config::SEGMENT_STEPS) { ps.segment_steps = 0; ps.segment_idx += 2; }
+      }
+      return steps;
+    }
+
+  } // DirectStepping
+
+#endif
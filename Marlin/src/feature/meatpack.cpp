@@ -39,7 +39,7 @@
 
 #include "../inc/MarlinConfig.h"
 
-#if HAS_MEATPACK
+#if ANY(HAS_MEATPACK, SD_BINARY_GCODE)
 
 #include "meatpack.h"
 
@@ -50,8 +50,8 @@
 #include "../core/debug_out.h"
 
 // The 15 most-common characters used in G-code, ~90-95% of all G-code uses these characters
-// Stored in SRAM for performance.
-uint8_t meatPackLookupTable[16] = {
+// Each instance keeps a copy in SRAM for performance, since NoSpaces changes it.
+static const uint8_t meatPackLookupTable[16] = {
   '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
   '.', ' ', '\n', 'G', 'X',
   '\0' // Unused. 0b1111 indicates a literal character
@@ -61,7 +61,10 @@ uint8_t meatPackLookupTable[16] = {
   uint8_t chars_decoded = 0;  // Log the first 64 bytes after each reset
 #endif
 
+MeatPack::MeatPack(const bool quiet/*=false*/) : quiet(quiet) { reset_state(); }
+
 void MeatPack::reset_state() {
+  memcpy(lookup, meatPackLookupTable, sizeof(lookup));
   state = 0;
   cmd_is_next = false;
   second_char = 0;
@@ -81,7 +84,7 @@ uint8_t MeatPack::unpack_chars(const uint8_t pk, uint8_t* __restrict const chars
     out = kFirstCharIsLiteral;
   else {
     const uint8_t chr = pk & 0x0F;
-    chars_out[0] = meatPackLookupTable[chr]; // Set the first char
+    chars_out[0] = lookup[chr]; // Set the first char
   }
 
   // Check if upper nybble is 1111... if so, we don't need the second char.
@@ -89,7 +92,7 @@ uint8_t MeatPack::unpack_chars(const uint8_t pk, uint8_t* __restrict const chars
     out |= kSecondCharIsLiteral;
   else {
     const uint8_t chr = (pk >> 4) & 0x0F;
-    chars_out[1] = meatPackLookupTable[chr]; // Set the second char
+    chars_out[1] = lookup[chr]; // Set the second char
   }
 
   return out;
@@ -147,7 +150,7 @@ void MeatPack::handle_output_char(const uint8_t c) {
 
 /**
  * Process a MeatPack command byte to update the state.
- * Report the new state to serial.
+ * Report the new state to serial, unless quiet.
  */
 void MeatPack::handle_command(const MeatPack_Command c) {
   switch (c) {
@@ -157,13 +160,13 @@ void MeatPack::handle_command(const MeatPack_Command c) {
     case MPCommand_ResetAll:        reset_state();                     DEBUG_ECHOLNPGM("[MPDBG] RESET REC"); break;
     case MPCommand_EnableNoSpaces:
       SBI(state, MPConfig_Bit_NoSpaces);
-      meatPackLookupTable[kSpaceCharIdx] = kSpaceCharReplace;          DEBUG_ECHOLNPGM("[MPDBG] ENA NSP");   break;
+      lookup[kSpaceCharIdx] = kSpaceCharReplace;                       DEBUG_ECHOLNPGM("[MPDBG] ENA NSP");   break;
     case MPCommand_DisableNoSpaces:
       CBI(state, MPConfig_Bit_NoSpaces);
-      meatPackLookupTable[kSpaceCharIdx] = ' ';                        DEBUG_ECHOLNPGM("[MPDBG] DIS NSP");   break;
+      lookup[kSpaceCharIdx] = ' ';                                     DEBUG_ECHOLNPGM("[MPDBG] DIS NSP");   break;
     default:                                                           DEBUG_ECHOLNPGM("[MPDBG] UNK CMD REC");
   }
-  report_state();
+  if (!quiet) report_state();
 }
 
 void MeatPack::report_state() {
@@ -215,4 +218,4 @@ uint8_t MeatPack::get_result_char(char * const __restrict out) {
   return res;
 }
 
-#endif // HAS_MEATPACK
+#endif // HAS_MEATPACK || SD_BINARY_GCODE
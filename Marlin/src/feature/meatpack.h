@@ -97,6 +97,8 @@ class MeatPack {
           full_char_count, // Counter for full-width characters to be received
           char_out_count;  // Stores number of characters to be read out.
   uint8_t char_out_buf[2]; // Output buffer for caching up to 2 characters
+  uint8_t lookup[16];      // Characters for each packed nybble (varies with NoSpaces)
+  bool quiet;              // Don't report state changes, e.g., when decoding a file
 
 public:
   // Pass in a character rx'd by SD card or serial. Automatically parses command/ctrl sequences,
@@ -118,7 +120,7 @@ public:
   void handle_output_char(const uint8_t c);
   void handle_rx_char_inner(const uint8_t c);
 
-  MeatPack() : cmd_is_next(false), state(0), second_char(0), cmd_count(0), full_char_count(0), char_out_count(0) {}
+  MeatPack(const bool quiet=false);
 };
 
 // Implement the MeatPack serial class so it's transparent to rest of the code
@@ -52,6 +52,15 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   bool PrintJobRecovery::ui_flag_resume; // = false
 #endif
 
+#if defined(POWER_LOSS_JOURNAL) || ENABLED(POWER_LOSS_SNAPSHOT)
+  #include "../libs/crc16.h"
+  static bool outage_save; // = false
+#endif
+
+#ifdef POWER_LOSS_JOURNAL
+  uint16_t PrintJobRecovery::journal_seq; // = 0
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
@@ -146,6 +155,7 @@ bool PrintJobRecovery::check() {
  */
 void PrintJobRecovery::purge() {
   init();
+  TERN_(POWER_LOSS_SNAPSHOT, clear_snapshot());
   card.removeJobRecoveryFile();
 }
 
@@ -156,11 +166,147 @@ void PrintJobRecovery::load() {
   if (exists()) {
     open(true);
     (void)file.read(&info, sizeof(info));
+    TERN_(POWER_LOSS_JOURNAL, load_journal());
     close();
   }
+  TERN_(POWER_LOSS_SNAPSHOT, load_snapshot());
   debug(F("Load"));
 }
 
+#if ENABLED(POWER_LOSS_SNAPSHOT)
+
+  // The info saved at the moment of the outage, valid with the magic and CRC
+  typedef struct {
+    uint32_t magic;
+    uint16_t crc;
+    job_recovery_info_t info;
+  } job_recovery_snapshot_t;
+
+  static_assert(sizeof(job_recovery_snapshot_t) <= SNAPSHOT_SRAM_SIZE, "job_recovery_info_t is too large for POWER_LOSS_SNAPSHOT.");
+
+  #define SNAPSHOT_MAGIC 0x534E5250UL // "PRNS"
+
+  static volatile job_recovery_snapshot_t &snapshot = *(volatile job_recovery_snapshot_t*)SNAPSHOT_SRAM_ADDR;
+
+  static uint16_t snapshot_crc(const job_recovery_info_t &info) {
+    uint16_t crc = 0;
+    crc16(&crc, &info, sizeof(info));
+    return crc;
+  }
+
+  /**
+   * Copy the info to Backup SRAM. The magic is written last.
+   */
+  void PrintJobRecovery::write_snapshot() {
+    snapshot.magic = 0;
+    memcpy((void*)&snapshot.info, &info, sizeof(info));
+    snapshot.crc = snapshot_crc(info);
+    snapshot.magic = SNAPSHOT_MAGIC;
+  }
+
+  void PrintJobRecovery::clear_snapshot() { snapshot.magic = 0; }
+
+  /**
+   * The snapshot is newer than anything on the SD card.
+   * Use it and write it to the recovery file.
+   */
+  void PrintJobRecovery::load_snapshot() {
+    if (snapshot.magic != SNAPSHOT_MAGIC) return;
+    job_recovery_info_t snap;
+    memcpy(&snap, (const void*)&snapshot.info, sizeof(snap));
+    if (snapshot.crc == snapshot_crc(snap) && snap.valid()) {
+      info = snap;
+      debug(F("Snapshot"));
+      write();
+    }
+    clear_snapshot();
+  }
+
+#endif // POWER_LOSS_SNAPSHOT
+
+#ifdef POWER_LOSS_JOURNAL
+
+  static uint16_t record_crc(const job_recovery_record_t &rec) {
+    uint16_t crc = 0;
+    crc16(&crc, &rec, offsetof(job_recovery_record_t, crc));
+    return crc;
+  }
+
+  /**
+   * Apply the newest record written since the last full save
+   */
+  void PrintJobRecovery::load_journal() {
+    journal_seq = 0;
+    if (!info.journal_id || file.fileSize() != JOURNAL_SIZE) return;
+
+    job_recovery_record_t rec, newest;
+    newest.seq = 0;
+    for (uint16_t i = 0; i < POWER_LOSS_JOURNAL; ++i) {
+      if (!file.seekSet(JOURNAL_START + uint32_t(i) * JOURNAL_SLOT)) break;
+      if (file.read(&rec, sizeof(rec)) != int16_t(sizeof(rec))) break;
+      if (rec.journal_id == info.journal_id && WITHIN(rec.seq, newest.seq + 1, POWER_LOSS_JOURNAL) && rec.crc == record_crc(rec))
+        newest = rec;
+    }
+    if (!newest.seq) return;
+
+    journal_seq = newest.seq;
+    info.sdpos = newest.sdpos;
+    info.current_position = newest.current_position;
+    info.print_job_elapsed = newest.print_job_elapsed;
+    info.zraise = newest.zraise;
+    info.feedrate = newest.feedrate;
+    info.flag.raised = newest.raised;
+    info.axis_relative = newest.axis_relative;
+    E_TERN_(info.active_extruder = newest.active_extruder);
+    TERN_(HAS_HOTEND, COPY(info.target_temperature, newest.target_temperature));
+    TERN_(HAS_HEATED_BED, info.target_temperature_bed = newest.target_temperature_bed);
+    TERN_(HAS_HEATED_CHAMBER, info.target_temperature_chamber = newest.target_temperature_chamber);
+    TERN_(HAS_FAN, COPY(info.fan_speed, newest.fan_speed));
+    #if ENABLED(FWRETRACT)
+      COPY(info.retract, newest.retract);
+      info.retract_hop = newest.retract_hop;
+    #endif
+  }
+
+  /**
+   * Write the changing state to the next slot of the journal
+   */
+  void PrintJobRecovery::write_record() {
+    static_assert(sizeof(job_recovery_record_t) <= 128, "job_recovery_record_t is too large.");
+
+    job_recovery_record_t rec;
+    rec.journal_id = info.journal_id;
+    rec.seq = ++journal_seq;
+    rec.sdpos = info.sdpos;
+    rec.current_position = info.current_position;
+    rec.print_job_elapsed = info.print_job_elapsed;
+    rec.zraise = info.zraise;
+    rec.feedrate = info.feedrate;
+    rec.raised = info.flag.raised;
+    rec.axis_relative = info.axis_relative;
+    E_TERN_(rec.active_extruder = info.active_extruder);
+    TERN_(HAS_HOTEND, COPY(rec.target_temperature, info.target_temperature));
+    TERN_(HAS_HEATED_BED, rec.target_temperature_bed = info.target_temperature_bed);
+    TERN_(HAS_HEATED_CHAMBER, rec.target_temperature_chamber = info.target_temperature_chamber);
+    TERN_(HAS_FAN, COPY(rec.fan_speed, info.fan_speed));
+    #if ENABLED(FWRETRACT)
+      COPY(rec.retract, info.retract);
+      rec.retract_hop = info.retract_hop;
+    #endif
+    rec.crc = record_crc(rec);
+
+    debug(F("Record"));
+
+    // Without the file the info must be saved in full
+    if (!card.openJobRecoveryJournal(JOURNAL_SIZE, false)) return write();
+
+    file.seekSet(JOURNAL_START + uint32_t(rec.seq - 1) * JOURNAL_SLOT);
+    if (file.write(&rec, sizeof(rec)) == -1) DEBUG_ECHOLNPGM("Power-loss record write failed.");
+    if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+  }
+
+#endif // POWER_LOSS_JOURNAL
+
 /**
  * Set info fields that won't change
  */
@@ -261,6 +407,16 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
     info.flag.dryrun = !!(marlin_debug_flags & MARLIN_DEBUG_DRYRUN);
     info.flag.allow_cold_extrusion = TERN0(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude);
 
+    // On outage save to Backup SRAM first. The SD card write may not finish.
+    TERN_(POWER_LOSS_SNAPSHOT, if (outage_save) write_snapshot());
+
+    #ifdef POWER_LOSS_JOURNAL
+      // Add a record unless a full save was requested or the ring is used up.
+      // An outage only needs the record, and must be quick.
+      if (info.journal_id && (!force || outage_save) && journal_seq < POWER_LOSS_JOURNAL)
+        return write_record();
+    #endif
+
     write();
   }
 }
@@ -325,7 +481,15 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
 
     // Save the current position, distance that Z was (or should be) raised,
     // and a flag whether the raise was already done here.
-    if (IS_SD_PRINTING()) save(true, zraise, ENABLED(BACKUP_POWER_SUPPLY));
+    if (IS_SD_PRINTING()) {
+      #if defined(POWER_LOSS_JOURNAL) || ENABLED(POWER_LOSS_SNAPSHOT)
+        outage_save = true;
+        save(true, zraise, ENABLED(BACKUP_POWER_SUPPLY));
+        outage_save = false;
+      #else
+        save(true, zraise, ENABLED(BACKUP_POWER_SUPPLY));
+      #endif
+    }
 
     // Tell the LCD about the outage, even though it is about to die
     TERN_(EXTENSIBLE_UI, ExtUI::onPowerLoss());
@@ -358,6 +522,20 @@ void PrintJobRecovery::write() {
 
   debug(F("Write"));
 
+  #ifdef POWER_LOSS_JOURNAL
+    // A new journal ID makes records written for the previous info obsolete
+    const uint32_t id = millis() | 1UL;
+    info.journal_id = (id == info.journal_id) ? id + 2 : id;
+    journal_seq = 0;
+    if (card.openJobRecoveryJournal(JOURNAL_SIZE, true)) {
+      file.seekSet(0);
+      if (file.write(&info, sizeof(info)) == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+      if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+      return;
+    }
+    info.journal_id = 0;  // No journal. Save in full every time.
+  #endif
+
   open(false);
   file.seekSet(0);
   const int16_t ret = file.write(&info, sizeof(info));
@@ -53,6 +53,10 @@
 //#define SAVE_EACH_CMD_MODE
 //#define SAVE_INFO_INTERVAL_MS 0
 
+#if defined(POWER_LOSS_JOURNAL_MS) && !defined(SAVE_INFO_INTERVAL_MS)
+  #define SAVE_INFO_INTERVAL_MS POWER_LOSS_JOURNAL_MS
+#endif
+
 typedef struct {
   uint8_t valid_head;
 
@@ -136,12 +140,52 @@ typedef struct {
     #endif
   } flag;
 
+  #ifdef POWER_LOSS_JOURNAL
+    uint32_t journal_id;          // Journal records with this ID update this info
+  #endif
+
   uint8_t valid_foot;
 
   bool valid() { return valid_head && valid_head == valid_foot; }
 
 } job_recovery_info_t;
 
+#ifdef POWER_LOSS_JOURNAL
+
+  // The changing part of the job state, saved between full saves
+  typedef struct {
+    uint32_t journal_id;          // ID of the info this record updates
+    uint32_t seq;                 // Record number since the last full save, from 1
+    uint32_t sdpos;
+    xyze_pos_t current_position;
+    millis_t print_job_elapsed;
+    float zraise;
+    uint16_t feedrate;
+    bool raised;
+    relative_t axis_relative;
+    #if HAS_MULTI_EXTRUDER
+      uint8_t active_extruder;
+    #endif
+    #if HAS_HOTEND
+      celsius_t target_temperature[HOTENDS];
+    #endif
+    #if HAS_HEATED_BED
+      celsius_t target_temperature_bed;
+    #endif
+    #if HAS_HEATED_CHAMBER
+      celsius_t target_temperature_chamber;
+    #endif
+    #if HAS_FAN
+      uint8_t fan_speed[FAN_COUNT];
+    #endif
+    #if ENABLED(FWRETRACT)
+      float retract[EXTRUDERS], retract_hop;
+    #endif
+    uint16_t crc;                 // CRC16 of the fields above
+  } job_recovery_record_t;
+
+#endif
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -227,6 +271,23 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #ifdef POWER_LOSS_JOURNAL
+      // Records go in fixed slots after the info, starting on a new block
+      static constexpr uint16_t JOURNAL_SLOT = sizeof(job_recovery_record_t) <= 32 ? 32
+                                             : sizeof(job_recovery_record_t) <= 64 ? 64 : 128;
+      static constexpr uint32_t JOURNAL_START = (sizeof(job_recovery_info_t) + 511) & ~511UL,
+                                JOURNAL_SIZE = JOURNAL_START + uint32_t(POWER_LOSS_JOURNAL) * JOURNAL_SLOT;
+      static uint16_t journal_seq;
+      static void write_record();
+      static void load_journal();
+    #endif
+
+    #if ENABLED(POWER_LOSS_SNAPSHOT)
+      static void write_snapshot();
+      static void load_snapshot();
+      static void clear_snapshot();
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const_float_t zraise);
     #endif
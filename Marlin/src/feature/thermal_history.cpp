@@ -0,0 +1,186 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/thermal_history.cpp
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(THERMAL_HISTORY)
+
+#include "thermal_history.h"
+#include "../module/temperature.h"
+#include "../libs/crc16.h"
+
+#if HAS_MEDIA
+  #include "../sd/cardreader.h"
+#endif
+
+ThermalHistory thermal_history;
+
+thermal_record_t ThermalHistory::ring[THERMAL_HISTORY_SIZE];
+ThermalHistory::index_t ThermalHistory::head, ThermalHistory::count;
+#if THERMAL_HISTORY_DIVISOR > 1
+  uint8_t ThermalHistory::divider;
+#endif
+
+static void store_sample(thermal_sample_t &s, const heater_info_t &h, const uint8_t state, const bool watching) {
+  s.temp = int16_t(h.celsius * 10.0f);
+  s.target = h.target;
+  s.power = h.soft_pwm_amount;
+  s.state = state | (watching ? THERMAL_HISTORY_WATCHING : 0);
+}
+
+/**
+ * Record the state of all heaters. Called from the main loop with each
+ * new set of temperature readings, before the thermal protection checks.
+ */
+void ThermalHistory::record() {
+  #if THERMAL_HISTORY_DIVISOR > 1
+    if (++divider < THERMAL_HISTORY_DIVISOR) return;
+    divider = 0;
+  #endif
+
+  thermal_record_t &r = ring[head];
+  r.ms = millis();
+  thermal_sample_t *s = r.heater;
+
+  #define _TR_STATE(I) thermalManager.tr_state_machine[Temperature::I].state
+
+  #if HAS_HOTEND
+    HOTEND_LOOP() store_sample(*s++, thermalManager.temp_hotend[e],
+      TERN(THERMAL_PROTECTION_HOTENDS, _TR_STATE(RunawayIndex(e)), 0),
+      TERN0(WATCH_HOTENDS, thermalManager.watch_hotend[e].next_ms != 0)
+    );
+  #endif
+  #if HAS_HEATED_BED
+    store_sample(*s++, thermalManager.temp_bed,
+      TERN(THERMAL_PROTECTION_BED, _TR_STATE(RUNAWAY_IND_BED), 0),
+      TERN0(WATCH_BED, thermalManager.watch_bed.next_ms != 0)
+    );
+  #endif
+  #if HAS_HEATED_CHAMBER
+    store_sample(*s++, thermalManager.temp_chamber,
+      TERN(THERMAL_PROTECTION_CHAMBER, _TR_STATE(RUNAWAY_IND_CHAMBER), 0),
+      TERN0(WATCH_CHAMBER, thermalManager.watch_chamber.next_ms != 0)
+    );
+  #endif
+  #if HAS_COOLER
+    store_sample(*s++, thermalManager.temp_cooler,
+      TERN(THERMAL_PROTECTION_COOLER, _TR_STATE(RUNAWAY_IND_COOLER), 0),
+      TERN0(WATCH_COOLER, thermalManager.watch_cooler.next_ms != 0)
+    );
+  #endif
+
+  UNUSED(s);
+
+  if (++head >= THERMAL_HISTORY_SIZE) head = 0;
+  if (count < THERMAL_HISTORY_SIZE) ++count;
+}
+
+thermal_history_header_t ThermalHistory::header() {
+  return { { 'T', 'H', 'S', 'T' }, THERMAL_HISTORY_VERSION, THERMAL_HISTORY_HEATERS, sizeof(thermal_record_t), count };
+}
+
+/**
+ * Print the history, oldest record first.
+ *
+ * Text: One line per record with the time and each heater as
+ *       "<id>:<temp> /<target> @:<power> S:<runaway state>[W]"
+ *
+ * Binary: "thermal_history:<size>" followed by <size> bytes (header
+ *         and records) then the CRC16 of those bytes (little-endian).
+ */
+void ThermalHistory::report(const bool binary) {
+  const index_t n = count;  // Recording may continue while reporting
+
+  if (binary) {
+    const thermal_history_header_t hdr = header();
+    SERIAL_ECHOLNPGM("thermal_history:", sizeof(hdr) + uint32_t(n) * sizeof(thermal_record_t));
+    uint16_t crc = 0;
+    auto send = [&](const void * const data, const uint16_t len) {
+      crc16(&crc, data, len);
+      const uint8_t *b = (const uint8_t*)data;
+      for (uint16_t i = 0; i < len; ++i) SERIAL_CHAR(b[i]);
+    };
+    send(&hdr, sizeof(hdr));
+    for (index_t i = 0; i < n; ++i) {
+      send(&oldest(i), sizeof(thermal_record_t));
+      if (!(i & 0x0F)) hal.watchdog_refresh();
+    }
+    SERIAL_CHAR(crc & 0xFF, crc >> 8);
+    SERIAL_EOL();
+    return;
+  }
+
+  static const char heater_ids[] PROGMEM = {
+    #if HAS_HOTEND
+      #define _HEATER_ID(N) '0' + (N),
+      REPEAT(HOTENDS, _HEATER_ID)
+      #undef _HEATER_ID
+    #endif
+    OPTITEM(HAS_HEATED_BED, 'B')
+    OPTITEM(HAS_HEATED_CHAMBER, 'C')
+    OPTITEM(HAS_COOLER, 'L')
+  };
+
+  SERIAL_ECHOLNPGM("Thermal history: ", n, " samples");
+  for (index_t i = 0; i < n; ++i) {
+    const thermal_record_t &r = oldest(i);
+    SERIAL_ECHO(r.ms);
+    for (uint8_t h = 0; h < THERMAL_HISTORY_HEATERS; ++h) {
+      const thermal_sample_t &s = r.heater[h];
+      const char id = pgm_read_byte(&heater_ids[h]);
+      if (NUMERIC(id)) SERIAL_ECHOPGM(" E", C(id)); else SERIAL_CHAR(' ', id);
+      SERIAL_ECHO(C(':'), p_float_t(s.temp * 0.1f, 1), F(" /"), s.target, F(" @:"), s.power, F(" S:"), s.state & ~THERMAL_HISTORY_WATCHING);
+      if (s.state & THERMAL_HISTORY_WATCHING) SERIAL_CHAR('W');
+    }
+    SERIAL_EOL();
+    if (!(i & 0x0F)) hal.watchdog_refresh();
+  }
+}
+
+#if HAS_MEDIA
+
+  /**
+   * Save the history in binary form to THERMAL_HISTORY_FILE in the SD root.
+   * Called when a thermal error halts the machine, with the heaters already off.
+   */
+  bool ThermalHistory::save() {
+    if (!card.isMounted()) return false;
+
+    MediaFile root = card.getroot(), file;
+    if (!file.open(&root, THERMAL_HISTORY_FILE, O_CREAT | O_WRITE | O_TRUNC)) return false;
+
+    const thermal_history_header_t hdr = header();
+    bool ok = file.write(&hdr, sizeof(hdr)) == int16_t(sizeof(hdr));
+    for (index_t i = 0; ok && i < hdr.count; ++i) {
+      ok = file.write(&oldest(i), sizeof(thermal_record_t)) == int16_t(sizeof(thermal_record_t));
+      hal.watchdog_refresh();
+    }
+    return file.close() && ok;
+  }
+
+#endif // HAS_MEDIA
+
+#endif // THERMAL_HISTORY
@@ -0,0 +1,85 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/thermal_history.h
+ *
+ * Ring buffer of heater telemetry for thermal protection post-mortems
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define THERMAL_HISTORY_HEATERS (HOTENDS + COUNT_ENABLED(HAS_HEATED_BED, HAS_HEATED_CHAMBER, HAS_COOLER))
+#define THERMAL_HISTORY_VERSION 1
+
+// Flags stored above the thermal runaway state
+#define THERMAL_HISTORY_WATCHING _BV(7)   // A heating watch is pending
+
+typedef struct {
+  int16_t temp;     // (°C * 10) Measured temperature
+  int16_t target;   // (°C) Target temperature
+  uint8_t power;    // Heater PWM amount
+  uint8_t state;    // Thermal runaway state (bits 0-6) and flags
+} thermal_sample_t;
+
+typedef struct {
+  uint32_t ms;      // millis() when the readings were taken
+  thermal_sample_t heater[THERMAL_HISTORY_HEATERS]; // Hotends, then Bed, Chamber, Cooler
+} thermal_record_t;
+
+// Precedes the records in binary dumps and saved files (little-endian)
+typedef struct {
+  char magic[4];          // "THST"
+  uint8_t version,        // THERMAL_HISTORY_VERSION
+          heaters;        // Samples per record
+  uint16_t record_size,   // Bytes per record
+           count;         // Number of records that follow, oldest first
+} thermal_history_header_t;
+
+class ThermalHistory {
+public:
+  static void reset() { head = count = 0; }
+  static void record();
+  static void report(const bool binary);
+  #if HAS_MEDIA
+    static bool save();
+  #endif
+
+private:
+  typedef uvalue_t(THERMAL_HISTORY_SIZE) index_t;
+  static thermal_record_t ring[THERMAL_HISTORY_SIZE];
+  static index_t head, count;
+  #if THERMAL_HISTORY_DIVISOR > 1
+    static uint8_t divider;
+  #endif
+
+  static thermal_history_header_t header();
+
+  // The nth record, counting from the oldest
+  static const thermal_record_t& oldest(const index_t n) {
+    const uint32_t i = uint32_t(head) + (THERMAL_HISTORY_SIZE) - count + n;
+    return ring[i % (THERMAL_HISTORY_SIZE)];
+  }
+};
+
+extern ThermalHistory thermal_history;
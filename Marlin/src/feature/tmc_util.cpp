@@ -43,6 +43,134 @@
   #endif
 #endif
 
+/**
+ * Read the raw DRV_STATUS register
+ */
+template<typename TMC>
+static uint32_t read_drv_status(TMC &st) { return st.DRV_STATUS(); }
+
+#if HAS_DRIVER(TMC2660)
+  template<char AXIS_LETTER, char DRIVER_ID, AxisEnum AXIS_ID>
+  static uint32_t read_drv_status(TMCMarlin<TMC2660Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> &st) { return st.DRVSTATUS(); }
+#endif
+
+#if ENABLED(TMC_STATUS_CACHE)
+
+  // Cached status older than this is read again from the driver
+  #define TMC_STATUS_MAX_AGE_MS ((MONITOR_DRIVER_STATUS_INTERVAL_MS) * 2)
+
+  template<typename TMC>
+  static uint32_t refresh_drv_status(TMC &st, const millis_t ms) {
+    st.drv_status_ms = ms ?: 1;
+    return (st.drv_status_cache = read_drv_status(st));
+  }
+
+  /**
+   * Get DRV_STATUS from the cache, only going to the bus if it's stale
+   */
+  template<typename TMC>
+  static uint32_t get_drv_status(TMC &st) {
+    const millis_t ms = millis();
+    if (st.drv_status_ms && PENDING(ms, st.drv_status_ms + TMC_STATUS_MAX_AGE_MS))
+      return st.drv_status_cache;
+    return refresh_drv_status(st, ms);
+  }
+
+  /**
+   * Refresh the cached status of the next driver in turn, pacing the reads
+   * so every driver is read once per MONITOR_DRIVER_STATUS_INTERVAL_MS.
+   * Only one bus transaction happens per call, so many drivers on one UART
+   * no longer hold up the main loop all at once.
+   */
+  static void refresh_next_drv_status(const millis_t ms) {
+    static millis_t next_refresh; // = 0
+    if (PENDING(ms, next_refresh)) return;
+
+    static uint8_t driver_index, driver_count = 1;
+    next_refresh = ms + (MONITOR_DRIVER_STATUS_INTERVAL_MS) / driver_count;
+
+    uint8_t n = 0;
+    #define _TMC_REFRESH(ST) if (driver_index == n++) refresh_drv_status(stepper##ST, ms)
+    #if AXIS_IS_TMC(X)
+      _TMC_REFRESH(X);
+    #endif
+    #if AXIS_IS_TMC(X2)
+      _TMC_REFRESH(X2);
+    #endif
+    #if AXIS_IS_TMC(Y)
+      _TMC_REFRESH(Y);
+    #endif
+    #if AXIS_IS_TMC(Y2)
+      _TMC_REFRESH(Y2);
+    #endif
+    #if AXIS_IS_TMC(Z)
+      _TMC_REFRESH(Z);
+    #endif
+    #if AXIS_IS_TMC(Z2)
+      _TMC_REFRESH(Z2);
+    #endif
+    #if AXIS_IS_TMC(Z3)
+      _TMC_REFRESH(Z3);
+    #endif
+    #if AXIS_IS_TMC(Z4)
+      _TMC_REFRESH(Z4);
+    #endif
+    #if AXIS_IS_TMC(I)
+      _TMC_REFRESH(I);
+    #endif
+    #if AXIS_IS_TMC(J)
+      _TMC_REFRESH(J);
+    #endif
+    #if AXIS_IS_TMC(K)
+      _TMC_REFRESH(K);
+    #endif
+    #if AXIS_IS_TMC(U)
+      _TMC_REFRESH(U);
+    #endif
+    #if AXIS_IS_TMC(V)
+      _TMC_REFRESH(V);
+    #endif
+    #if AXIS_IS_TMC(W)
+      _TMC_REFRESH(W);
+    #endif
+    #if AXIS_IS_TMC(E0)
+      _TMC_REFRESH(E0);
+    #endif
+    #if AXIS_IS_TMC(E1)
+      _TMC_REFRESH(E1);
+    #endif
+    #if AXIS_IS_TMC(E2)
+      _TMC_REFRESH(E2);
+    #endif
+    #if AXIS_IS_TMC(E3)
+      _TMC_REFRESH(E3);
+    #endif
+    #if AXIS_IS_TMC(E4)
+      _TMC_REFRESH(E4);
+    #endif
+    #if AXIS_IS_TMC(E5)
+      _TMC_REFRESH(E5);
+    #endif
+    #if AXIS_IS_TMC(E6)
+      _TMC_REFRESH(E6);
+    #endif
+    #if AXIS_IS_TMC(E7)
+      _TMC_REFRESH(E7);
+    #endif
+    #undef _TMC_REFRESH
+
+    driver_count = n ?: 1;
+    if (++driver_index >= n) driver_index = 0;
+  }
+
+#else
+
+  // Without the cache every status request goes to the driver
+  template<typename TMC>
+  static uint32_t get_drv_status(TMC &st) { return read_drv_status(st); }
+
+#endif // TMC_STATUS_CACHE
+
 /**
  * Check for over temperature or short to ground error flags.
  * Report and log warning of overtemperature condition.
@@ -83,7 +211,7 @@
       static uint32_t get_pwm_scale(TMC2130Stepper &st) { return st.PWM_SCALE(); }
     #endif
 
-    static TMC_driver_data get_driver_data(TMC2130Stepper &st) {
+    static TMC_driver_data get_driver_data(TMC2130Stepper &, const uint32_t ds) {
       constexpr uint8_t OT_bp = 25, OTPW_bp = 26;
       constexpr uint32_t S2G_bm = 0x18000000;
       #if ENABLED(TMC_DEBUG)
@@ -94,7 +222,7 @@
         constexpr uint8_t STST_bp = 31;
       #endif
       TMC_driver_data data;
-      const auto ds = data.drv_status = st.DRV_STATUS();
+      data.drv_status = ds;
       #ifdef __AVR__
 
         // 8-bit optimization saves up to 70 bytes of PROGMEM per axis
@@ -144,11 +272,11 @@
       static uint32_t get_pwm_scale(TMC2208Stepper &st) { return st.pwm_scale_sum(); }
     #endif
 
-    static TMC_driver_data get_driver_data(TMC2208Stepper &st) {
+    static TMC_driver_data get_driver_data(TMC2208Stepper &, const uint32_t ds) {
       constexpr uint8_t OTPW_bp = 0, OT_bp = 1;
       constexpr uint8_t S2G_bm = 0b111100; // 2..5
       TMC_driver_data data;
-      const auto ds = data.drv_status = st.DRV_STATUS();
+      data.drv_status = ds;
       data.is_otpw = TEST(ds, OTPW_bp);
       data.is_ot = TEST(ds, OT_bp);
       data.is_s2g = !!(ds & S2G_bm);
@@ -181,11 +309,11 @@
       static uint32_t get_pwm_scale(TMC2660Stepper) { return 0; }
     #endif
 
-    static TMC_driver_data get_driver_data(TMC2660Stepper &st) {
+    static TMC_driver_data get_driver_data(TMC2660Stepper &, const uint32_t ds) {
       constexpr uint8_t OT_bp = 1, OTPW_bp = 2;
       constexpr uint8_t S2G_bm = 0b11000;
       TMC_driver_data data;
-      const auto ds = data.drv_status = st.DRVSTATUS();
+      data.drv_status = ds;
       uint8_t spart = ds & 0xFF;
       data.is_otpw = TEST(spart, OTPW_bp);
       data.is_ot = TEST(spart, OT_bp);
@@ -284,7 +412,7 @@
 
   template<typename TMC>
   bool monitor_tmc_driver(TMC &st, const bool need_update_error_counters, const bool need_debug_reporting) {
-    TMC_driver_data data = get_driver_data(st);
+    TMC_driver_data data = get_driver_data(st, get_drv_status(st));
     if (data.drv_status == 0xFFFFFFFF || data.drv_status == 0x0) return false;
 
     bool should_step_down = false;
@@ -328,6 +456,8 @@
   void monitor_tmc_drivers() {
     const millis_t ms = millis();
 
+    TERN_(TMC_STATUS_CACHE, refresh_next_drv_status(ms));
+
     // Poll TMC drivers at the configured interval
     static millis_t next_poll = 0;
     const bool need_update_error_counters = ELAPSED(ms, next_poll);
@@ -764,7 +894,7 @@
       case TMC_DRV_OTPW:      if (st.otpw())    SERIAL_CHAR('*'); break;
       case TMC_OT:            if (st.ot())      SERIAL_CHAR('*'); break;
       case TMC_DRV_STATUS_HEX: {
-        const uint32_t drv_status = st.DRV_STATUS();
+        const uint32_t drv_status = get_drv_status(st);
         SERIAL_CHAR('\t');
         st.printLabel();
         SERIAL_CHAR('\t');
@@ -51,6 +51,13 @@ typedef struct {
   uint8_t hstrt;
 } chopper_timing_t;
 
+#if ENABLED(TMC_SHADOW_WRITES)
+  enum TMCWrittenBit : uint8_t { TMC_WRITTEN_mA, TMC_WRITTEN_hold_mult, TMC_WRITTEN_stealthChop, TMC_WRITTEN_tpwmthrs, TMC_WRITTEN_sgt };
+  #define TMC_NEEDS_WRITE(F,V) this->needs_write(TMC_WRITTEN_##F, this->written.F, V)
+#else
+  #define TMC_NEEDS_WRITE(F,V) true
+#endif
+
 template<char AXIS_LETTER, char DRIVER_ID>
 class TMCStorage {
   protected:
@@ -68,6 +75,32 @@ class TMCStorage {
       void clear_otpw() { flag_otpw = 0; }
     #endif
 
+    #if ENABLED(TMC_STATUS_CACHE)
+      uint32_t drv_status_cache = 0;  // Last DRV_STATUS read from the driver
+      millis_t drv_status_ms = 0;     // Time of that read, 0 if not read yet
+    #endif
+
+    #if ENABLED(TMC_SHADOW_WRITES)
+      // Settings last sent to the driver, so unchanged values aren't sent again
+      struct {
+        uint16_t mA;
+        float hold_mult;
+        OPTCODE(HAS_STEALTHCHOP,  bool stealthChop)
+        OPTCODE(HYBRID_THRESHOLD, uint16_t tpwmthrs)
+        OPTCODE(USE_SENSORLESS,   int16_t sgt)
+      } written;
+      uint8_t written_valid = 0;                    // TMCWrittenBit flags for fields holding a known value
+      void forget_written() { written_valid = 0; }  // The driver is about to be (re)initialized
+
+      template<typename T, typename V>
+      bool needs_write(const uint8_t bit, T &last, const V value) {
+        if (TEST(written_valid, bit) && last == T(value)) return false;
+        last = T(value);
+        SBI(written_valid, bit);
+        return true;
+      }
+    #endif
+
     uint16_t getMilliamps() { return val_mA; }
 
     void printLabel() {
@@ -100,18 +133,18 @@ class TMCMarlin : public TMC, public TMCStorage<AXIS_LETTER, DRIVER_ID> {
     uint16_t rms_current() { return TMC::rms_current(); }
     void rms_current(uint16_t mA) {
       this->val_mA = mA;
-      TMC::rms_current(mA);
+      if (TMC_NEEDS_WRITE(mA, mA)) TMC::rms_current(mA);
     }
     void rms_current(const uint16_t mA, const float mult) {
       this->val_mA = mA;
-      TMC::rms_current(mA, mult);
+      if (TMC_NEEDS_WRITE(mA, mA) | TMC_NEEDS_WRITE(hold_mult, mult)) TMC::rms_current(mA, mult);
     }
     uint16_t get_microstep_counter() { return TMC::MSCNT(); }
 
     #if HAS_STEALTHCHOP
       bool get_stealthChop()                { return this->en_pwm_mode(); }
       bool get_stored_stealthChop()         { return this->stored.stealthChop_enabled; }
-      void refresh_stepping_mode()          { this->en_pwm_mode(this->stored.stealthChop_enabled); }
+      void refresh_stepping_mode()          { if (TMC_NEEDS_WRITE(stealthChop, this->stored.stealthChop_enabled)) this->en_pwm_mode(this->stored.stealthChop_enabled); }
       void set_stealthChop(const bool stch) { this->stored.stealthChop_enabled = stch; refresh_stepping_mode(); }
       bool toggle_stepping_mode()           { set_stealthChop(!this->stored.stealthChop_enabled); return get_stealthChop(); }
     #endif
@@ -127,7 +160,8 @@ class TMCMarlin : public TMC, public TMCStorage<AXIS_LETTER, DRIVER_ID> {
         return _tmc_thrs(this->microsteps(), this->TPWMTHRS(), planner.settings.axis_steps_per_mm[AXIS_ID]);
       }
       void set_pwm_thrs(const uint32_t thrs) {
-        TMC::TPWMTHRS(_tmc_thrs(this->microsteps(), thrs, planner.settings.axis_steps_per_mm[AXIS_ID]));
+        const uint16_t tpwmthrs = _tmc_thrs(this->microsteps(), thrs, planner.settings.axis_steps_per_mm[AXIS_ID]);
+        if (TMC_NEEDS_WRITE(tpwmthrs, tpwmthrs)) TMC::TPWMTHRS(tpwmthrs);
         TERN_(HAS_MARLINUI_MENU, this->stored.hybrid_thrs = thrs);
       }
     #endif
@@ -136,7 +170,7 @@ class TMCMarlin : public TMC, public TMCStorage<AXIS_LETTER, DRIVER_ID> {
       int16_t homing_threshold() { return TMC::sgt(); }
       void homing_threshold(int16_t sgt_val) {
         sgt_val = (int16_t)constrain(sgt_val, sgt_min, sgt_max);
-        TMC::sgt(sgt_val);
+        if (TMC_NEEDS_WRITE(sgt, sgt_val)) TMC::sgt(sgt_val);
         TERN_(HAS_MARLINUI_MENU, this->stored.homing_thrs = sgt_val);
       }
       #if ENABLED(SPI_ENDSTOPS)
@@ -173,18 +207,18 @@ class TMCMarlin<TMC2208Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC220
     uint16_t rms_current() { return TMC2208Stepper::rms_current(); }
     void rms_current(const uint16_t mA) {
       this->val_mA = mA;
-      TMC2208Stepper::rms_current(mA);
+      if (TMC_NEEDS_WRITE(mA, mA)) TMC2208Stepper::rms_current(mA);
     }
     void rms_current(const uint16_t mA, const float mult) {
       this->val_mA = mA;
-      TMC2208Stepper::rms_current(mA, mult);
+      if (TMC_NEEDS_WRITE(mA, mA) | TMC_NEEDS_WRITE(hold_mult, mult)) TMC2208Stepper::rms_current(mA, mult);
     }
     uint16_t get_microstep_counter() { return TMC2208Stepper::MSCNT(); }
 
     #if HAS_STEALTHCHOP
       bool get_stealthChop()                { return !this->en_spreadCycle(); }
       bool get_stored_stealthChop()         { return this->stored.stealthChop_enabled; }
-      void refresh_stepping_mode()          { this->en_spreadCycle(!this->stored.stealthChop_enabled); }
+      void refresh_stepping_mode()          { if (TMC_NEEDS_WRITE(stealthChop, this->stored.stealthChop_enabled)) this->en_spreadCycle(!this->stored.stealthChop_enabled); }
       void set_stealthChop(const bool stch) { this->stored.stealthChop_enabled = stch; refresh_stepping_mode(); }
       bool toggle_stepping_mode()           { set_stealthChop(!this->stored.stealthChop_enabled); return get_stealthChop(); }
     #endif
@@ -200,7 +234,8 @@ class TMCMarlin<TMC2208Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC220
         return _tmc_thrs(this->microsteps(), this->TPWMTHRS(), planner.settings.axis_steps_per_mm[AXIS_ID]);
       }
       void set_pwm_thrs(const uint32_t thrs) {
-        TMC2208Stepper::TPWMTHRS(_tmc_thrs(this->microsteps(), thrs, planner.settings.axis_steps_per_mm[AXIS_ID]));
+        const uint16_t tpwmthrs = _tmc_thrs(this->microsteps(), thrs, planner.settings.axis_steps_per_mm[AXIS_ID]);
+        if (TMC_NEEDS_WRITE(tpwmthrs, tpwmthrs)) TMC2208Stepper::TPWMTHRS(tpwmthrs);
         TERN_(HAS_MARLINUI_MENU, this->stored.hybrid_thrs = thrs);
       }
     #endif
@@ -225,18 +260,18 @@ class TMCMarlin<TMC2209Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC220
     uint16_t rms_current() { return TMC2209Stepper::rms_current(); }
     void rms_current(const uint16_t mA) {
       this->val_mA = mA;
-      TMC2209Stepper::rms_current(mA);
+      if (TMC_NEEDS_WRITE(mA, mA)) TMC2209Stepper::rms_current(mA);
     }
     void rms_current(const uint16_t mA, const float mult) {
       this->val_mA = mA;
-      TMC2209Stepper::rms_current(mA, mult);
+      if (TMC_NEEDS_WRITE(mA, mA) | TMC_NEEDS_WRITE(hold_mult, mult)) TMC2209Stepper::rms_current(mA, mult);
     }
     uint16_t get_microstep_counter() { return TMC2209Stepper::MSCNT(); }
 
     #if HAS_STEALTHCHOP
       bool get_stealthChop()                { return !this->en_spreadCycle(); }
       bool get_stored_stealthChop()         { return this->stored.stealthChop_enabled; }
-      void refresh_stepping_mode()          { this->en_spreadCycle(!this->stored.stealthChop_enabled); }
+      void refresh_stepping_mode()          { if (TMC_NEEDS_WRITE(stealthChop, this->stored.stealthChop_enabled)) this->en_spreadCycle(!this->stored.stealthChop_enabled); }
       void set_stealthChop(const bool stch) { this->stored.stealthChop_enabled = stch; refresh_stepping_mode(); }
       bool toggle_stepping_mode()           { set_stealthChop(!this->stored.stealthChop_enabled); return get_stealthChop(); }
     #endif
@@ -252,7 +287,8 @@ class TMCMarlin<TMC2209Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC220
         return _tmc_thrs(this->microsteps(), this->TPWMTHRS(), planner.settings.axis_steps_per_mm[AXIS_ID]);
       }
       void set_pwm_thrs(const uint32_t thrs) {
-        TMC2209Stepper::TPWMTHRS(_tmc_thrs(this->microsteps(), thrs, planner.settings.axis_steps_per_mm[AXIS_ID]));
+        const uint16_t tpwmthrs = _tmc_thrs(this->microsteps(), thrs, planner.settings.axis_steps_per_mm[AXIS_ID]);
+        if (TMC_NEEDS_WRITE(tpwmthrs, tpwmthrs)) TMC2209Stepper::TPWMTHRS(tpwmthrs);
         TERN_(HAS_MARLINUI_MENU, this->stored.hybrid_thrs = thrs);
       }
     #endif
@@ -260,7 +296,7 @@ class TMCMarlin<TMC2209Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC220
       int16_t homing_threshold() { return TMC2209Stepper::SGTHRS(); }
       void homing_threshold(int16_t sgt_val) {
         sgt_val = (int16_t)constrain(sgt_val, sgt_min, sgt_max);
-        TMC2209Stepper::SGTHRS(sgt_val);
+        if (TMC_NEEDS_WRITE(sgt, sgt_val)) TMC2209Stepper::SGTHRS(sgt_val);
         TERN_(HAS_MARLINUI_MENU, this->stored.homing_thrs = sgt_val);
       }
     #endif
@@ -290,7 +326,7 @@ class TMCMarlin<TMC2660Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC266
     uint16_t rms_current() { return TMC2660Stepper::rms_current(); }
     void rms_current(const uint16_t mA) {
       this->val_mA = mA;
-      TMC2660Stepper::rms_current(mA);
+      if (TMC_NEEDS_WRITE(mA, mA)) TMC2660Stepper::rms_current(mA);
     }
     uint16_t get_microstep_counter() { return TMC2660Stepper::mstep(); }
 
@@ -304,7 +340,7 @@ class TMCMarlin<TMC2660Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC266
       int16_t homing_threshold() { return TMC2660Stepper::sgt(); }
       void homing_threshold(int16_t sgt_val) {
         sgt_val = (int16_t)constrain(sgt_val, sgt_min, sgt_max);
-        TMC2660Stepper::sgt(sgt_val);
+        if (TMC_NEEDS_WRITE(sgt, sgt_val)) TMC2660Stepper::sgt(sgt_val);
         TERN_(HAS_MARLINUI_MENU, this->stored.homing_thrs = sgt_val);
       }
     #endif
@@ -137,6 +137,11 @@ public:
       bed_mesh_t z_values;
     #endif
 
+    #if ENABLED(ABL_PRINT_AREA_PROBING)
+      bool partial;
+      xy_uint8_t partial_min, partial_max;  // Range of mesh indexes to re-probe
+    #endif
+
     #if ENABLED(AUTO_BED_LEVELING_LINEAR)
       int indexIntoAB[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
       float eqnAMatrix[GRID_MAX_POINTS * 3],  // "A" matrix of the linear system of equations
@@ -204,6 +209,9 @@ public:
  *
  *  Z  Supply an additional Z probe offset
  *
+ *  M  Re-probe only the mesh points covering the L R F B area (plus ABL_PRINT_AREA_MARGIN)
+ *     and merge them into the stored mesh. Requires ABL_PRINT_AREA_PROBING.
+ *
  * Extra parameters with PROBE_MANUALLY:
  *
  *  To do manual probing simply repeat G29 until the procedure is complete.
@@ -407,7 +415,11 @@ G29_TYPE GcodeSuite::G29() {
         abl.probe_position_rb.set(parser.linearval('R', x_max), parser.linearval('B', y_max));
       }
 
-      if (!probe.good_bounds(abl.probe_position_lf, abl.probe_position_rb)) {
+      // M = Keep the stored grid and only re-probe the points covering L R F B
+      TERN_(ABL_PRINT_AREA_PROBING, abl.partial = parser.seen_test('M'));
+
+      // The print area may extend past the probe's reach. Only the stored grid is probed.
+      if (!TERN0(ABL_PRINT_AREA_PROBING, abl.partial) && !probe.good_bounds(abl.probe_position_lf, abl.probe_position_rb)) {
         if (DEBUGGING(LEVELING)) {
           DEBUG_ECHOLNPGM("G29 L", abl.probe_position_lf.x, " R", abl.probe_position_rb.x,
                              " F", abl.probe_position_lf.y, " B", abl.probe_position_rb.y);
@@ -420,6 +432,30 @@ G29_TYPE GcodeSuite::G29() {
       abl.gridSpacing.set((abl.probe_position_rb.x - abl.probe_position_lf.x) / (abl.grid_points.x - 1),
                           (abl.probe_position_rb.y - abl.probe_position_lf.y) / (abl.grid_points.y - 1));
 
+      #if ENABLED(ABL_PRINT_AREA_PROBING)
+        if (abl.partial) {
+          if (!leveling_is_valid()) {
+            SERIAL_ERROR_MSG("No bilinear grid");
+            G29_RETURN(false, false);
+          }
+
+          const xy_pos_t &start = bedlevel.grid_start, &spacing = bedlevel.grid_spacing;
+          abl.partial_min.set(
+            constrain(FLOOR((abl.probe_position_lf.x - (ABL_PRINT_AREA_MARGIN) - start.x) / spacing.x), 0, (GRID_MAX_POINTS_X) - 1),
+            constrain(FLOOR((abl.probe_position_lf.y - (ABL_PRINT_AREA_MARGIN) - start.y) / spacing.y), 0, (GRID_MAX_POINTS_Y) - 1)
+          );
+          abl.partial_max.set(
+            constrain(CEIL((abl.probe_position_rb.x + (ABL_PRINT_AREA_MARGIN) - start.x) / spacing.x), 0, (GRID_MAX_POINTS_X) - 1),
+            constrain(CEIL((abl.probe_position_rb.y + (ABL_PRINT_AREA_MARGIN) - start.y) / spacing.y), 0, (GRID_MAX_POINTS_Y) - 1)
+          );
+
+          if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing mesh points X", abl.partial_min.x, "-", abl.partial_max.x, " Y", abl.partial_min.y, "-", abl.partial_max.y);
+
+          abl.probe_position_lf = start;
+          abl.gridSpacing = spacing;
+        }
+      #endif
+
     #endif // ABL_USES_GRID
 
     if (abl.verbose_level > 0) {
@@ -507,7 +543,8 @@ G29_TYPE GcodeSuite::G29() {
         abl.reenable = false;   // Can't re-enable (on error) until the new grid is written
       }
       // Pre-populate local Z values from the stored mesh
-      TERN_(IS_KINEMATIC, COPY(abl.z_values, bedlevel.z_values));
+      if (ENABLED(IS_KINEMATIC) || TERN0(ABL_PRINT_AREA_PROBING, abl.partial))
+        COPY(abl.z_values, bedlevel.z_values);
     #endif
 
   } // !g29_in_progress
@@ -698,6 +735,12 @@ G29_TYPE GcodeSuite::G29() {
           // Avoid probing outside the round or hexagonal area
           if (TERN0(IS_KINEMATIC, !probe.can_reach(abl.probePos))) continue;
 
+          // Keep the stored Z outside the requested area
+          #if ENABLED(ABL_PRINT_AREA_PROBING)
+            if (abl.partial && !(WITHIN(abl.meshCount.x, abl.partial_min.x, abl.partial_max.x)
+                              && WITHIN(abl.meshCount.y, abl.partial_min.y, abl.partial_max.y))) continue;
+          #endif
+
           if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing mesh point ", pt_index, "/", abl.abl_points, ".");
           TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT_F(MSG_PROBING_POINT), int(pt_index), int(abl.abl_points)));
 
@@ -741,21 +784,54 @@ G29_TYPE GcodeSuite::G29() {
               abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
             }
 
-            // Wait around until the real axis position reaches the comparison point
-            // TODO: Use NEAR() because float is imprecise
             constexpr AxisEnum axis = TERN(PROBE_Y_FIRST, Y_AXIS, X_AXIS);
             const float cmp = abl.probePos[axis] - probe.offset_xy[axis];
-            float pos;
-            for (;;) {
-              pos = planner.get_axis_position_mm(axis);
-              if (inInc > 0 ? (pos >= cmp) : (pos <= cmp)) break;
-              idle_no_sleep();
-            }
-            //if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM_P(axis == Y_AXIS ? PSTR("Y=") : PSTR("X=", pos);
 
-            safe_delay(4);
-            abl.measured_z = current_position.z - bdl.read();
-            if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPGM("x_cur ", planner.get_axis_position_mm(X_AXIS), " z ", abl.measured_z);
+            #ifdef BD_SENSOR_SWEEP_WINDOW
+
+              /**
+               * Read the sensor continuously while the probe passes the point.
+               * Each reading is placed at the stepper position midway through the read.
+               * A straight line fitted to the readings in the window gives Z at the point.
+               */
+              uint16_t n = 0;
+              float sum_d = 0, sum_z = 0, sum_dd = 0, sum_dz = 0;
+              for (;;) {
+                const bool stopped = !planner.busy();    // At the end of the row
+                const float pos1 = planner.get_axis_position_mm(axis),
+                            z = current_position.z - bdl.read(),
+                            pos2 = planner.get_axis_position_mm(axis),
+                            d = ((pos1 + pos2) * 0.5f - cmp) * inInc;   // Distance past the point
+                if (d > BD_SENSOR_SWEEP_WINDOW && n) break;
+                if (d >= -(BD_SENSOR_SWEEP_WINDOW) || stopped) {
+                  n++; sum_d += d; sum_z += z; sum_dd += sq(d); sum_dz += d * z;
+                }
+                if (stopped) break;
+                idle_no_sleep();
+              }
+              const float var = n * sum_dd - sq(sum_d);
+              abl.measured_z = var > 1e-6f
+                ? (sum_z * sum_dd - sum_d * sum_dz) / var  // Intercept at the point
+                : sum_z / n;
+              if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPGM("pos ", cmp, " samples ", n, " z ", abl.measured_z);
+
+            #else
+
+              // Wait around until the real axis position reaches the comparison point
+              // TODO: Use NEAR() because float is imprecise
+              float pos;
+              for (;;) {
+                pos = planner.get_axis_position_mm(axis);
+                if (inInc > 0 ? (pos >= cmp) : (pos <= cmp)) break;
+                idle_no_sleep();
+              }
+              //if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM_P(axis == Y_AXIS ? PSTR("Y=") : PSTR("X=", pos);
+
+              safe_delay(4);
+              abl.measured_z = current_position.z - bdl.read();
+              if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPGM("x_cur ", planner.get_axis_position_mm(X_AXIS), " z ", abl.measured_z);
+
+            #endif
 
           #else // !BD_SENSOR_PROBE_NO_STOP
 
@@ -840,6 +840,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 306: M306(); break;                                  // M306: MPC autotune
       #endif
 
+      #if ENABLED(THERMAL_HISTORY)
+        case 307: M307(); break;                                  // M307: Report thermal history
+      #endif
+
       #if ENABLED(REPETIER_GCODE_M360)
         case 360: M360(); break;                                  // M360: Firmware settings
       #endif
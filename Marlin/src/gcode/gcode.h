@@ -220,6 +220,7 @@
  * M304 - Set bed PID parameters P I and D. (Requires PIDTEMPBED)
  * M305 - Set user thermistor parameters R T and P. (Requires TEMP_SENSOR_x 1000)
  * M306 - MPC autotune. (Requires MPCTEMP)
+ * M307 - Report thermal history. (Requires THERMAL_HISTORY)
  * M309 - Set chamber PID parameters P I and D. (Requires PIDTEMPCHAMBER)
  * M350 - Set microstepping mode. (Requires digital microstepping pins.)
  * M351 - Toggle MS1 MS2 pins directly. (Requires digital microstepping pins.)
@@ -1002,6 +1003,10 @@ private:
     static void M306_report(const bool forReplay=true);
   #endif
 
+  #if ENABLED(THERMAL_HISTORY)
+    static void M307();
+  #endif
+
   #if ENABLED(PIDTEMPCHAMBER)
     static void M309();
     static void M309_report(const bool forReplay=true);
@@ -53,10 +53,13 @@ void GcodeSuite::G6() {
   // No speed is set, can't schedule the move
   if (!planner.last_page_step_rate) return;
 
-  const page_idx_t page_idx = (page_idx_t)parser.value_ulong();
+  // Ignore pages that don't exist
+  const uint32_t index = parser.value_ulong();
+  if (index >= DirectStepping::Config::PAGE_COUNT) return;
+  const page_idx_t page_idx = (page_idx_t)index;
 
-  uint16_t num_steps = DirectStepping::Config::TOTAL_STEPS;
-  if (parser.seen('S')) num_steps = parser.value_ushort();
+  uint32_t num_steps = page_manager.get_page_steps(page_idx);
+  if (parser.seen('S')) num_steps = parser.value_ulong();
 
   planner.buffer_page(page_idx, 0, num_steps);
   reset_stepper_timeout();
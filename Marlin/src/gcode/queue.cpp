@@ -41,6 +41,11 @@ GCodeQueue queue;
   #include "../feature/binary_stream.h"
 #endif
 
+#if ENABLED(DIRECT_STEPPING) && !defined(__AVR__)
+  #include "../feature/direct_stepping.h"
+  #define HAS_PAGE_RX 1 // Pages arrive here, not from the serial RX interrupt
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../feature/powerloss.h"
 #endif
@@ -299,6 +304,28 @@ static bool serial_data_available(serial_index_t index) {
 
 inline int read_serial(const serial_index_t index) { return SERIAL_IMPL.read(index); }
 
+#if HAS_PAGE_RX
+  // The port sending the page being received. Other ports keep sending G-code.
+  static serial_index_t page_rx_port = 0;
+
+  // Page bytes from this port go to the page manager
+  static bool is_page_port(const serial_index_t index) {
+    return !page_manager.receiving() || index.index == page_rx_port.index;
+  }
+
+  // Read page data straight into the page being received. Return true if any was read.
+  static bool receive_page_span(const serial_index_t index) {
+    if (index.index != page_rx_port.index) return false;
+    uint16_t room;
+    uint8_t * const span = page_manager.claim_rx_span(room);
+    if (!span) return false;
+    uint16_t count = 0;
+    while (count < room && SERIAL_IMPL.available(index)) span[count++] = read_serial(index);
+    if (count) page_manager.commit_rx_span(count);
+    return count;
+  }
+#endif
+
 #if (defined(ARDUINO_ARCH_STM32F4) || defined(ARDUINO_ARCH_STM32)) && defined(USBCON)
 
   /**
@@ -438,6 +465,11 @@ void GCodeQueue::get_serial_commands() {
     hadData = false;
 
     for (uint8_t p = 0; p < NUM_SERIAL; ++p) {
+      #if HAS_PAGE_RX
+        // Keep receiving page data even when the queue is full
+        if (receive_page_span(p)) { hadData = true; continue; }
+      #endif
+
       // Check if the queue is full and exit if it is.
       if (ring_buffer.full()) return;
 
@@ -459,6 +491,14 @@ void GCodeQueue::get_serial_commands() {
       }
 
       const char serial_char = (char)c;
+
+      #if HAS_PAGE_RX
+        if (is_page_port(p) && page_manager.maybe_store_rxd_char(serial_char)) {
+          page_rx_port = p;
+          continue; // Page header or checksum
+        }
+      #endif
+
       SerialState &serial = serial_state[p];
 
       if (ISEOL(serial_char)) {
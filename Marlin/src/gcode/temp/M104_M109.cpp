@@ -62,6 +62,10 @@
  * M109 Parameters
  *  R<target> : The target temperature in current units. Wait for heating and cooling.
  *
+ * With PREDICTIVE_HEATUP_WAIT:
+ *  L<seconds> : Return once the target is predicted to be reached within this time.
+ *               The first extruding move waits for the rest. Use L0 to wait normally.
+ *
  * Examples
  *  M104 S100 : Set target to 100° and return.
  *  M109 R150 : Set target to 150°. Wait until the hotend gets close to 150°.
@@ -127,8 +131,12 @@ void GcodeSuite::M104_M109(const bool isM109) {
 
   TERN_(AUTOTEMP, planner.autotemp_M104_M109());
 
-  if (isM109 && got_temp)
-    (void)thermalManager.wait_for_hotend(target_extruder, no_wait_for_cooling);
+  if (isM109 && got_temp) {
+    (void)thermalManager.wait_for_hotend(target_extruder, no_wait_for_cooling
+      OPTARG(G26_CLICK_CAN_CANCEL, false)
+      OPTARG(PREDICTIVE_HEATUP_WAIT, parser.ushortval('L', PREDICTIVE_HEATUP_LEAD_TIME))
+    );
+  }
 }
 
 #endif // HAS_HOTEND
@@ -48,6 +48,10 @@
  * M190 Parameters
  *  R<target> : The target temperature in current units. Wait for heating and cooling.
  *
+ * With PREDICTIVE_HEATUP_WAIT:
+ *  L<seconds> : Return once the target is predicted to be reached within this time.
+ *               The first extruding move waits for the rest. Use L0 to wait normally.
+ *
  * Examples
  *  M140 S60 : Set target to 60° and return right away.
  *  M190 R40 : Set target to 40°. Wait until the bed gets close to 40°.
@@ -124,7 +128,10 @@ void GcodeSuite::M140_M190(const bool isM190) {
       }
     #endif
 
-    thermalManager.wait_for_bed(no_wait_for_cooling);
+    thermalManager.wait_for_bed(no_wait_for_cooling
+      OPTARG(G26_CLICK_CAN_CANCEL, false)
+      OPTARG(PREDICTIVE_HEATUP_WAIT, parser.ushortval('L', PREDICTIVE_HEATUP_LEAD_TIME))
+    );
   }
   else {
     ui.set_status_reset_fn([]{
@@ -27,14 +27,26 @@
 #include "../gcode.h"
 #include "../../module/temperature.h"
 
+#if ENABLED(AUTO_REPORT_TEMPERATURES_BINARY)
+  #include "../queue.h"
+#endif
+
 /**
  * M155: Set temperature auto-report interval. M155 S<seconds>
+ *
+ * With AUTO_REPORT_TEMPERATURES_BINARY:
+ *  B<bool> : Send binary report frames to the requesting serial port
  */
 void GcodeSuite::M155() {
 
   if (parser.seenval('S'))
     thermalManager.auto_reporter.set_interval(parser.value_byte());
 
+  #if ENABLED(AUTO_REPORT_TEMPERATURES_BINARY)
+    if (parser.seen('B'))
+      thermalManager.set_binary_report(queue.ring_buffer.command_port(), parser.value_bool());
+  #endif
+
 }
 
 #endif // AUTO_REPORT_TEMPERATURES
@@ -0,0 +1,60 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * gcode/temp/M307.cpp
+ *
+ * Thermal History
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(THERMAL_HISTORY)
+
+#include "../gcode.h"
+#include "../../feature/thermal_history.h"
+
+/**
+ * M307: Report the thermal history
+ *
+ * Parameters
+ *  B : Dump the history in binary form
+ *  R : Reset the history
+ *  W : Write the history to THERMAL_HISTORY_FILE on the SD card
+ */
+void GcodeSuite::M307() {
+  if (parser.seen_test('R')) return thermal_history.reset();
+
+  #if HAS_MEDIA
+    if (parser.seen_test('W')) {
+      if (thermal_history.save())
+        SERIAL_ECHOLNPGM("Thermal history saved to " THERMAL_HISTORY_FILE);
+      else
+        SERIAL_ERROR_MSG("Thermal history not saved");
+      return;
+    }
+  #endif
+
+  thermal_history.report(parser.seen_test('B'));
+}
+
+#endif // THERMAL_HISTORY
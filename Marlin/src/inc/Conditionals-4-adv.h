@@ -1298,6 +1298,9 @@
   #ifndef STEPPER_PAGE_FORMAT
     #define STEPPER_PAGE_FORMAT SP_4x2_256
   #endif
+  #ifndef STEPPER_PAGE_SIZE
+    #define STEPPER_PAGE_SIZE 1024
+  #endif
   #ifndef PAGE_MANAGER
     #define PAGE_MANAGER SerialPageManager
   #endif
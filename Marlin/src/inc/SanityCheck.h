@@ -1049,6 +1049,42 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #error "To use CHAMBER_LIMIT_SWITCHING you must disable PIDTEMPCHAMBER."
 #endif
 
+/**
+ * Thermal History
+ */
+#if ENABLED(THERMAL_HISTORY)
+  #if NONE(THERMAL_PROTECTION_HOTENDS, THERMAL_PROTECTION_BED, THERMAL_PROTECTION_CHAMBER, THERMAL_PROTECTION_COOLER)
+    #error "THERMAL_HISTORY requires THERMAL_PROTECTION_HOTENDS, _BED, _CHAMBER, or _COOLER."
+  #elif !WITHIN(THERMAL_HISTORY_SIZE, 2, 65535)
+    #error "THERMAL_HISTORY_SIZE must be from 2 to 65535."
+  #elif !WITHIN(THERMAL_HISTORY_DIVISOR, 1, 255)
+    #error "THERMAL_HISTORY_DIVISOR must be from 1 to 255."
+  #elif HAS_MEDIA && !defined(THERMAL_HISTORY_FILE)
+    #error "THERMAL_HISTORY requires THERMAL_HISTORY_FILE with SD support."
+  #endif
+#endif
+
+/**
+ * Predictive Heat-up Wait
+ */
+#if ENABLED(PREDICTIVE_HEATUP_WAIT)
+  #if !HAS_EXTRUDERS
+    #error "PREDICTIVE_HEATUP_WAIT requires at least one extruder."
+  #elif !defined(PREDICTIVE_HEATUP_LEAD_TIME)
+    #error "PREDICTIVE_HEATUP_WAIT requires PREDICTIVE_HEATUP_LEAD_TIME."
+  #elif PREDICTIVE_HEATUP_LEAD_TIME < 0
+    #error "PREDICTIVE_HEATUP_LEAD_TIME must be 0 or greater."
+  #endif
+#endif
+
+#if ENABLED(AUTO_REPORT_TEMPERATURES_BINARY)
+  #if DISABLED(AUTO_REPORT_TEMPERATURES)
+    #error "AUTO_REPORT_TEMPERATURES_BINARY requires AUTO_REPORT_TEMPERATURES."
+  #elif !WITHIN(AUTO_REPORT_BINARY_KEYFRAME, 1, 255)
+    #error "AUTO_REPORT_BINARY_KEYFRAME must be between 1 and 255."
+  #endif
+#endif
+
 /**
  * AUTOTEMP
  */
@@ -1073,6 +1109,8 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #error "CNC_WORKSPACE_PLANES currently requires a Z axis"
 #elif ENABLED(DIRECT_STEPPING) && NUM_AXES > XYZ
   #error "DIRECT_STEPPING does not currently support more than 3 axes (i.e., XYZ)."
+#elif ENABLED(DIRECT_STEPPING) && (STEPPER_PAGE_SIZE < 512 || STEPPER_PAGE_SIZE > 8192 || STEPPER_PAGE_SIZE % 4)
+  #error "STEPPER_PAGE_SIZE must be a multiple of 4 from 512 to 8192."
 #elif ENABLED(FOAMCUTTER_XYUV) && !(HAS_I_AXIS && HAS_J_AXIS)
   #error "FOAMCUTTER_XYUV requires I and J steppers to be enabled."
 #elif ENABLED(LIN_ADVANCE) && HAS_I_AXIS
@@ -1199,6 +1237,31 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
       #error "DELTA requires GRID_MAX_POINTS_X and GRID_MAX_POINTS_Y to be 3 or higher."
     #endif
   #endif
+  #if ENABLED(DELTA_IK_BATCH)
+    #if !WITHIN(DELTA_IK_BATCH_SIZE, 2, 32)
+      #error "DELTA_IK_BATCH_SIZE must be from 2 to 32."
+    #elif ENABLED(SKEW_CORRECTION)
+      #error "DELTA_IK_BATCH is not compatible with SKEW_CORRECTION."
+    #elif ABL_PLANAR
+      #error "DELTA_IK_BATCH is not compatible with AUTO_BED_LEVELING_3POINT or AUTO_BED_LEVELING_LINEAR."
+    #endif
+  #endif
+#endif
+#if ENABLED(DELTA_IK_TAYLOR)
+  static_assert(DELTA_IK_TAYLOR_TOLERANCE > 0 && DELTA_IK_TAYLOR_TOLERANCE <= 0.01, "DELTA_IK_TAYLOR_TOLERANCE must be greater than 0 and no more than 0.01.");
+#endif
+
+/**
+ * Adaptive Kinematic Segments
+ */
+#if ENABLED(ADAPTIVE_KINEMATIC_SEGMENTS)
+  #if ENABLED(POLARGRAPH)
+    #error "ADAPTIVE_KINEMATIC_SEGMENTS is not compatible with POLARGRAPH."
+  #elif ENABLED(DELTA_IK_BATCH)
+    #error "ADAPTIVE_KINEMATIC_SEGMENTS is not compatible with DELTA_IK_BATCH."
+  #endif
+  static_assert(ADAPTIVE_SEGMENT_TOLERANCE > 0, "ADAPTIVE_SEGMENT_TOLERANCE must be greater than 0.");
+  static_assert(ADAPTIVE_SEGMENT_MAX_LENGTH > 0, "ADAPTIVE_SEGMENT_MAX_LENGTH must be greater than 0.");
 #endif
 
 /**
@@ -1600,6 +1663,13 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
     #error "GRID_MAX_POINTS_[XY] must be between 3 and 255."
   #elif ALL(UBL_HILBERT_CURVE, DELTA)
     #error "UBL_HILBERT_CURVE can only be used with a square / rectangular printable area."
+  #elif ENABLED(UBL_ADAPTIVE_PROBING)
+    #if !HAS_BED_PROBE
+      #error "UBL_ADAPTIVE_PROBING requires a bed probe."
+    #elif !WITHIN(UBL_ADAPTIVE_STRIDE, 2, 255)
+      #error "UBL_ADAPTIVE_STRIDE must be between 2 and 255."
+    #endif
+    static_assert(UBL_ADAPTIVE_TOLERANCE > 0, "UBL_ADAPTIVE_TOLERANCE must be greater than 0.");
   #endif
 #elif ENABLED(MESH_BED_LEVELING)
   #if ENABLED(DELTA)
@@ -3729,9 +3799,60 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #error "X_AXIS_TWIST_COMPENSATION is incompatible with NOZZLE_AS_PROBE."
 #endif
 
+#if ENABLED(UBL_BED_TEMP_MESHES)
+  #if DISABLED(AUTO_BED_LEVELING_UBL)
+    #error "UBL_BED_TEMP_MESHES requires AUTO_BED_LEVELING_UBL."
+  #elif !HAS_HEATED_BED
+    #error "UBL_BED_TEMP_MESHES requires a heated bed."
+  #endif
+  static_assert(UBL_BED_TEMP_MESH_STEP > 0, "UBL_BED_TEMP_MESH_STEP must be greater than 0.");
+#endif
+
+#if !HAS_BED_PROBE && ANY(Z_CLEARANCE_FROM_BED, PROBE_QUEUE_RAISE)
+  #error "Z_CLEARANCE_FROM_BED and PROBE_QUEUE_RAISE require a bed probe."
+#endif
+
+#if ENABLED(ABL_BICUBIC_INTERPOLATION)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "ABL_BICUBIC_INTERPOLATION requires AUTO_BED_LEVELING_BILINEAR."
+  #elif ANY(ABL_BILINEAR_SUBDIVISION, ABL_BILINEAR_COEFFICIENTS)
+    #error "ABL_BICUBIC_INTERPOLATION is not compatible with ABL_BILINEAR_SUBDIVISION or ABL_BILINEAR_COEFFICIENTS."
+  #elif IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+    #error "ABL_BICUBIC_INTERPOLATION requires SEGMENT_LEVELED_MOVES."
+  #endif
+#endif
+
+#if ENABLED(AUTO_BED_LEVELING_BILINEAR) && IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+  #if ENABLED(ABL_BILINEAR_SUBDIVISION) && (GRID_MAX_CELLS_X * (BILINEAR_SUBDIVISIONS) + 1 > 64 || GRID_MAX_CELLS_Y * (BILINEAR_SUBDIVISIONS) + 1 > 64)
+    #error "ABL_BILINEAR_SUBDIVISION with more than 64 subdivided points per axis requires SEGMENT_LEVELED_MOVES."
+  #elif GRID_MAX_POINTS_X > 64 || GRID_MAX_POINTS_Y > 64
+    #error "AUTO_BED_LEVELING_BILINEAR with more than 64 points per axis requires SEGMENT_LEVELED_MOVES."
+  #endif
+#endif
+
+#if ENABLED(ABL_PRINT_AREA_PROBING)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "ABL_PRINT_AREA_PROBING requires AUTO_BED_LEVELING_BILINEAR."
+  #elif ENABLED(PROBE_MANUALLY)
+    #error "ABL_PRINT_AREA_PROBING is not compatible with PROBE_MANUALLY."
+  #elif ENABLED(BD_SENSOR_PROBE_NO_STOP)
+    #error "ABL_PRINT_AREA_PROBING is not compatible with BD_SENSOR_PROBE_NO_STOP."
+  #endif
+  static_assert(ABL_PRINT_AREA_MARGIN >= 0, "ABL_PRINT_AREA_MARGIN must be 0 or greater.");
+#endif
+
+#ifdef BD_SENSOR_SWEEP_WINDOW
+  #if DISABLED(BD_SENSOR_PROBE_NO_STOP)
+    #error "BD_SENSOR_SWEEP_WINDOW requires BD_SENSOR_PROBE_NO_STOP."
+  #endif
+  static_assert(BD_SENSOR_SWEEP_WINDOW > 0, "BD_SENSOR_SWEEP_WINDOW must be greater than 0.");
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #if ENABLED(BACKUP_POWER_SUPPLY) && !PIN_EXISTS(POWER_LOSS)
     #error "BACKUP_POWER_SUPPLY requires a POWER_LOSS_PIN."
+  #elif ENABLED(POWER_LOSS_SNAPSHOT) && !PIN_EXISTS(POWER_LOSS)
+    #error "POWER_LOSS_SNAPSHOT requires a POWER_LOSS_PIN."
   #elif ALL(POWER_LOSS_PULLUP, POWER_LOSS_PULLDOWN)
     #error "You can't enable POWER_LOSS_PULLUP and POWER_LOSS_PULLDOWN at the same time."
   #elif ENABLED(POWER_LOSS_RECOVER_ZHOME) && Z_HOME_TO_MAX
@@ -4006,6 +4127,34 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
 #if HAS_TMC_SPI && ALL(MONITOR_DRIVER_STATUS, HAS_MEDIA, USES_SHARED_SPI)
   #error "MONITOR_DRIVER_STATUS and SDSUPPORT cannot be used together on boards with shared SPI."
 #endif
+#if defined(SD_READ_AHEAD_BLOCKS) && HAS_MEDIA && !WITHIN(SD_READ_AHEAD_BLOCKS, 2, 16)
+  #error "SD_READ_AHEAD_BLOCKS must be between 2 and 16."
+#endif
+#if defined(SD_SEEK_INDEX_SIZE) && HAS_MEDIA && !WITHIN(SD_SEEK_INDEX_SIZE, 2, 255)
+  #error "SD_SEEK_INDEX_SIZE must be between 2 and 255."
+#endif
+#if defined(SD_DIR_INDEX_SIZE) && HAS_MEDIA && !WITHIN(SD_DIR_INDEX_SIZE, 8, 1024)
+  #error "SD_DIR_INDEX_SIZE must be between 8 and 1024."
+#endif
+#if ENABLED(SD_COMPRESSED_GCODE) && !HAS_MEDIA
+  #error "SD_COMPRESSED_GCODE requires SDSUPPORT or equivalent."
+#elif ENABLED(SD_BINARY_GCODE) && DISABLED(SD_COMPRESSED_GCODE)
+  #error "SD_BINARY_GCODE requires SD_COMPRESSED_GCODE."
+#endif
+#ifdef SD_WRITE_BUFFER_BLOCKS
+  #if ENABLED(SDCARD_READONLY)
+    #error "SD_WRITE_BUFFER_BLOCKS is not needed with SDCARD_READONLY."
+  #elif HAS_MEDIA && !WITHIN(SD_WRITE_BUFFER_BLOCKS, 2, 16)
+    #error "SD_WRITE_BUFFER_BLOCKS must be between 2 and 16."
+  #endif
+#endif
+
+#if ENABLED(TMC_STATUS_CACHE) && DISABLED(MONITOR_DRIVER_STATUS)
+  #error "TMC_STATUS_CACHE requires MONITOR_DRIVER_STATUS."
+#endif
+#if ENABLED(TMC_SHADOW_WRITES) && !HAS_TRINAMIC_CONFIG
+  #error "TMC_SHADOW_WRITES requires Trinamic (TMCxxxx) stepper drivers."
+#endif
 
 // Although it just toggles STEP, EDGE_STEPPING requires HIGH state for logic
 #if ENABLED(EDGE_STEPPING)
@@ -4089,12 +4238,37 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #endif
 #endif
 
+#if ENABLED(POWER_LOSS_SNAPSHOT)
+  #if DISABLED(POWER_LOSS_RECOVERY)
+    #error "POWER_LOSS_SNAPSHOT requires POWER_LOSS_RECOVERY."
+  #elif !defined(HAL_STM32)
+    #error "POWER_LOSS_SNAPSHOT requires STM32F4 or STM32F7 Backup SRAM."
+  #endif
+#endif
+
+#ifdef POWER_LOSS_JOURNAL
+  #if DISABLED(POWER_LOSS_RECOVERY)
+    #error "POWER_LOSS_JOURNAL requires POWER_LOSS_RECOVERY."
+  #elif !WITHIN(POWER_LOSS_JOURNAL, 4, 1024)
+    #error "POWER_LOSS_JOURNAL must be between 4 and 1024."
+  #endif
+#endif
+
 /**
  * Sanity Check for MEATPACK and BINARY_FILE_TRANSFER Features
  */
 #if ALL(HAS_MEATPACK, BINARY_FILE_TRANSFER)
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
+#ifdef BINARY_STREAM_WINDOW
+  #if DISABLED(BINARY_FILE_TRANSFER)
+    #error "BINARY_STREAM_WINDOW requires BINARY_FILE_TRANSFER."
+  #elif !WITHIN(BINARY_STREAM_WINDOW, 2, 16) || (BINARY_STREAM_WINDOW & (BINARY_STREAM_WINDOW - 1))
+    #error "BINARY_STREAM_WINDOW must be 2, 4, 8, or 16."
+  #elif !WITHIN(BINARY_STREAM_PACKET_SIZE, 64, 4096)
+    #error "BINARY_STREAM_PACKET_SIZE must be between 64 and 4096."
+  #endif
+#endif
 
 /**
  * Sanity Check for Slim LCD Menus and Probe Offset Wizard
@@ -4393,6 +4567,8 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
     #error "FT_MOTION does not currently support MIXING_EXTRUDER."
   #elif DISABLED(FTM_UNIFIED_BWS)
     #error "FT_MOTION requires FTM_UNIFIED_BWS to be enabled because FBS is not yet implemented."
+  #elif ENABLED(FTM_LEVELING) && NONE(AUTO_BED_LEVELING_BILINEAR, MESH_BED_LEVELING)
+    #error "FTM_LEVELING requires AUTO_BED_LEVELING_BILINEAR or MESH_BED_LEVELING."
   #endif
   #if !HAS_X_AXIS
     static_assert(FTM_DEFAULT_SHAPER_X != ftMotionShaper_NONE, "Without any linear axes FTM_DEFAULT_SHAPER_X must be ftMotionShaper_NONE.");
@@ -4156,7 +4156,12 @@ void drawMaxAccelMenu() {
     void resetMesh() { bedLevelTools.meshReset(); LCD_MESSAGE(MSG_MESH_RESET); }
     void setEditMeshX() { hmiValue.select = 0; setIntOnClick(0, GRID_MAX_POINTS_X - 1, bedLevelTools.mesh_x, applyEditMeshX, liveEditMesh); }
     void setEditMeshY() { hmiValue.select = 1; setIntOnClick(0, GRID_MAX_POINTS_Y - 1, bedLevelTools.mesh_y, applyEditMeshY, liveEditMesh); }
-    void setEditZValue() { setPFloatOnClick(Z_OFFSET_MIN, Z_OFFSET_MAX, 3); }
+    void applyEditZValue() {
+      #if ANY(ABL_BILINEAR_SUBDIVISION, ABL_BILINEAR_COEFFICIENTS)
+        bedlevel.refresh_bed_level();
+      #endif
+    }
+    void setEditZValue() { setPFloatOnClick(Z_OFFSET_MIN, Z_OFFSET_MAX, 3, applyEditZValue); }
   #endif
 
 #endif // HAS_MESH
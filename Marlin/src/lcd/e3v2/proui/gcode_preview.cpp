@@ -99,6 +99,61 @@ void getValue(const char * const buf, PGM_P const key, float &value) {
   }
 }
 
+#if ENABLED(SD_BINARY_GCODE)
+
+  // Get a number from binary G-code metadata
+  void getMetaValue(PGM_P const key, float &value) {
+    char buf[24];
+    if (card.getMetadata(key, buf, sizeof(buf))) value = atof(buf);
+  }
+
+  // Get a time like "1d 2h 3m 4s" from binary G-code metadata, in seconds
+  void getMetaTime(PGM_P const key, float &value) {
+    char buf[24];
+    if (!card.getMetadata(key, buf, sizeof(buf))) return;
+    uint32_t secs = 0, num = 0;
+    for (const char *c = buf; *c; ++c) {
+      if (NUMERIC(*c)) { num = num * 10 + (*c - '0'); continue; }
+      switch (*c) {
+        case 'd': secs += num * 86400; break;
+        case 'h': secs += num * 3600; break;
+        case 'm': secs += num * 60; break;
+        case 's': secs += num; break;
+      }
+      num = 0;
+    }
+    value = secs;
+  }
+
+  // Binary G-code has the values and the thumbnail in blocks of their own
+  bool hasBinaryPreview() {
+    getMetaTime(PSTR("estimated printing time (normal mode)"), fileprop.time);
+    getMetaValue(PSTR("filament used [mm]"), fileprop.filament);
+    fileprop.filament /= 1000;
+    getMetaValue(PSTR("layer_height"), fileprop.layer);
+    getMetaValue(PSTR("max_layer_z"), fileprop.height);
+
+    const uint16_t size = card.getThumbnail(CardReader::BGC_JPG, THUMBWIDTH, THUMBHEIGHT);
+    if (!size) {
+      card.closefile();
+      LCD_MESSAGE_F("Thumbnail not found");
+      return false;
+    }
+
+    uint8_t thumbdata[size];
+    fileprop.thumbsize = card.getThumbnail(CardReader::BGC_JPG, THUMBWIDTH, THUMBHEIGHT, thumbdata, size);
+    card.closefile();
+    if (!fileprop.thumbsize) return false;
+    DWINUI::writeToSRAM(0x00, fileprop.thumbsize, thumbdata);
+
+    fileprop.thumbwidth = THUMBWIDTH;
+    fileprop.thumbheight = THUMBHEIGHT;
+
+    return true;
+  }
+
+#endif
+
 bool Preview::hasPreview() {
   const char * const tbstart = PSTR("; thumbnail begin " STRINGIFY(THUMBWIDTH) "x" STRINGIFY(THUMBHEIGHT));
   char *posptr = nullptr;
@@ -110,6 +165,10 @@ bool Preview::hasPreview() {
 
   card.openFileRead(fileprop.name);
 
+  #if ENABLED(SD_BINARY_GCODE)
+    if (card.isBinaryGcode()) return hasBinaryPreview();
+  #endif
+
   char buf[256];
   uint8_t nbyte = 1;
   while (!fileprop.thumbstart && nbyte > 0 && indx < 4 * sizeof(buf)) {
@@ -989,7 +989,9 @@ namespace ExtUI {
       void setMeshPoint(const xy_uint8_t &pos, const_float_t zoff) {
         if (WITHIN(pos.x, 0, (GRID_MAX_POINTS_X) - 1) && WITHIN(pos.y, 0, (GRID_MAX_POINTS_Y) - 1)) {
           bedlevel.z_values[pos.x][pos.y] = zoff;
-          TERN_(ABL_BILINEAR_SUBDIVISION, bedlevel.refresh_bed_level());
+          #if ANY(ABL_BILINEAR_SUBDIVISION, ABL_BILINEAR_COEFFICIENTS)
+            bedlevel.refresh_bed_level();
+          #endif
         }
       }
 
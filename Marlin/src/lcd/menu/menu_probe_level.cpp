@@ -214,6 +214,7 @@
 #if ENABLED(MESH_EDIT_MENU)
 
   inline void refresh_planner() {
+    TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
     set_current_from_steppers_for_axis(ALL_AXES_ENUM);
     sync_plan_position();
   }
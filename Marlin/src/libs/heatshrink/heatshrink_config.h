@@ -17,6 +17,10 @@
   #define HEATSHRINK_STATIC_INPUT_BUFFER_SIZE 32
   #define HEATSHRINK_STATIC_WINDOW_BITS 8
   #define HEATSHRINK_STATIC_LOOKAHEAD_BITS 4
+  // Make room for a larger window, set per decoder in window_sz2
+  #if ENABLED(SD_BINARY_GCODE)
+    #define HEATSHRINK_STATIC_MAX_WINDOW_BITS 12 // bgcode uses 11/4 or 12/4
+  #endif
 #endif
 
 // Turn on logging for debugging
@@ -22,7 +22,7 @@
 
 #include "../../inc/MarlinConfigPre.h"
 
-#if ENABLED(BINARY_FILE_TRANSFER)
+#if ANY(BINARY_FILE_TRANSFER, SD_COMPRESSED_GCODE)
 
 /**
  * libs/heatshrink/heatshrink_decoder.cpp
@@ -380,4 +380,4 @@ static void push_byte(heatshrink_decoder *hsd, output_info *oi, uint8_t byte) {
   (void)hsd;
 }
 
-#endif // BINARY_FILE_TRANSFER
+#endif // BINARY_FILE_TRANSFER || SD_COMPRESSED_GCODE
@@ -60,8 +60,17 @@ typedef enum {
 #else
 #define HEATSHRINK_DECODER_INPUT_BUFFER_SIZE(_) \
   HEATSHRINK_STATIC_INPUT_BUFFER_SIZE
+#ifdef HEATSHRINK_STATIC_MAX_WINDOW_BITS
+#define HEATSHRINK_DECODER_WINDOW_BITS(BUF) \
+  ((BUF)->window_sz2)
+#define HEATSHRINK_DECODER_WINDOW_BUFFER_BITS \
+  (HEATSHRINK_STATIC_MAX_WINDOW_BITS)
+#else
 #define HEATSHRINK_DECODER_WINDOW_BITS(_) \
   (HEATSHRINK_STATIC_WINDOW_BITS)
+#define HEATSHRINK_DECODER_WINDOW_BUFFER_BITS \
+  (HEATSHRINK_STATIC_WINDOW_BITS)
+#endif
 #define HEATSHRINK_DECODER_LOOKAHEAD_BITS(BUF) \
   (HEATSHRINK_STATIC_LOOKAHEAD_BITS)
 #endif
@@ -85,8 +94,13 @@ typedef struct {
   /* Input buffer, then expansion window buffer */
   uint8_t buffers[];
 #else
+#ifdef HEATSHRINK_STATIC_MAX_WINDOW_BITS
+  /* Window buffer bits, up to the max. Set before a reset. */
+  uint8_t window_sz2 = HEATSHRINK_STATIC_WINDOW_BITS;
+#endif
+
   /* Input buffer, then expansion window buffer */
-  uint8_t buffers[(1 << HEATSHRINK_DECODER_WINDOW_BITS(_)) + HEATSHRINK_DECODER_INPUT_BUFFER_SIZE(_)];
+  uint8_t buffers[(1 << HEATSHRINK_DECODER_WINDOW_BUFFER_BITS) + HEATSHRINK_DECODER_INPUT_BUFFER_SIZE(_)];
 #endif
 } heatshrink_decoder;
 
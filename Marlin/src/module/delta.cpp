@@ -124,6 +124,56 @@ void inverse_kinematics(const xyz_pos_t &raw) {
   #endif
 }
 
+#if ENABLED(DELTA_IK_BATCH)
+
+  /**
+   * Along a line the squared column of each tower is a quadratic in the
+   * point index, so forward differences replace the HYPOT2 with two adds.
+   * Every batch starts from an exact value so float error can't build up.
+   *
+   * With DELTA_IK_TAYLOR the square root is also stepped, by the expansion
+   * s' = s * (1 + r/2 - r^2/8) with r = dq / q. For |r| < 1/4 the error of
+   * each step is under s * |r|^3 / 8, and an exact SQRT is taken whenever
+   * the sum of these bounds would exceed DELTA_IK_TAYLOR_TOLERANCE.
+   */
+  void inverse_kinematics_batch(const xy_pos_t &start, const xy_pos_t &step, const uint8_t count, abc_float_t cols[]) {
+    #if HAS_HOTEND_OFFSET
+      const xy_pos_t pos = { start.x - hotend_offset[active_extruder].x, start.y - hotend_offset[active_extruder].y };
+    #else
+      const xy_pos_t &pos = start;
+    #endif
+    const float step2 = HYPOT2(step.x, step.y), ddq = -2.0f * step2;
+    LOOP_ABC(t) {
+      const xy_pos_t d = delta_tower[t] - pos;
+      float q = delta_diagonal_rod_2_tower[t] - HYPOT2(d.x, d.y),
+            dq = 2.0f * (d.x * step.x + d.y * step.y) - step2;
+      #if ENABLED(DELTA_IK_TAYLOR)
+        float s = SQRT(q), inv_s = 1.0f / s, err = 0;
+        cols[0][t] = s;
+        for (uint8_t i = 1; i < count; ++i) {
+          const float r = dq * sq(inv_s);
+          q += dq; dq += ddq;
+          err += ABS(r) * sq(r) * s * 0.125f;
+          if (err > float(DELTA_IK_TAYLOR_TOLERANCE)) {
+            s = SQRT(q); inv_s = 1.0f / s; err = 0;
+          }
+          else {
+            s *= 1.0f + r * (0.5f - 0.125f * r);
+            inv_s *= 1.0f - r * (0.5f - 0.375f * r);
+          }
+          cols[i][t] = s;
+        }
+      #else
+        for (uint8_t i = 0; i < count; ++i) {
+          cols[i][t] = SQRT(q);
+          q += dq; dq += ddq;
+        }
+      #endif
+    }
+  }
+
+#endif // DELTA_IK_BATCH
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
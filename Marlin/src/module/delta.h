@@ -83,6 +83,15 @@ void recalc_delta_settings();
 
 void inverse_kinematics(const xyz_pos_t &raw);
 
+#if ENABLED(DELTA_IK_BATCH)
+  /**
+   * Get the tower columns for 'count' points spaced 'step' apart on a line,
+   * starting at 'start'. A column is the height of a carriage above the
+   * effector, so the carriage position is the point's Z plus its column.
+   */
+  void inverse_kinematics_batch(const xy_pos_t &start, const xy_pos_t &step, const uint8_t count, abc_float_t cols[]);
+#endif
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
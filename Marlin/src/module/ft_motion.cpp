@@ -28,6 +28,10 @@
 #include "stepper.h" // Access stepper block queue function and abort status.
 #include "endstops.h"
 
+#if ENABLED(FTM_LEVELING)
+  #include "../feature/bedlevel/bedlevel.h"
+#endif
+
 FTMotion ftMotion;
 
 //-----------------------------------------------------------------
@@ -80,6 +84,16 @@ uint32_t FTMotion::N1,                          // Number of data points in the
 
 uint32_t FTMotion::max_intervals;               // Total number of data points that will be generated from block.
 
+// Leveling along the move.
+#if ENABLED(FTM_LEVELING)
+  xy_pos_t FTMotion::levelStart,                // (mm) Machine XY at the start of the block
+           FTMotion::levelDist;                 // (mm) XY distance of the block
+  float FTMotion::levelZ0,                      // (mm) Z correction at the block start
+        FTMotion::levelDZ,                      // (mm) Change in Z correction to the block end
+        FTMotion::levelFade = 0.0f,             // (ratio) Leveling fade factor of the block
+        FTMotion::levelOneOverLength;           // (1/mm) Reciprocal of the block length
+#endif
+
 // Make vector variables.
 uint32_t FTMotion::makeVector_idx = 0,          // Index of fixed time trajectory generation of the overall block.
          FTMotion::makeVector_batchIdx = 0;     // Index of fixed time trajectory generation within the batch.
@@ -421,6 +435,7 @@ void FTMotion::runoutBlock() {
 
   startPosn = endPosn_prevBlock;
   ratio.reset();
+  TERN_(FTM_LEVELING, levelFade = 0.0f);
 
   const int32_t n_to_fill_batch = (FTM_WINDOW_SIZE) - makeVector_batchIdx;
 
@@ -475,6 +490,19 @@ void FTMotion::loadBlockData(block_t * const current_block) {
 
   ratio = moveDist * oneOverLength;
 
+  #if ENABLED(FTM_LEVELING)
+    // The planner leveled the block ends. Between them the Z correction
+    // is the mesh correction less the straight line the planner assumed.
+    levelFade = current_block->level_fade;
+    if (levelFade) {
+      levelStart = current_block->level_start;
+      levelDist = current_block->level_end - levelStart;
+      levelZ0 = bedlevel.get_z_correction(levelStart);
+      levelDZ = bedlevel.get_z_correction(current_block->level_end) - levelZ0;
+      levelOneOverLength = oneOverLength;
+    }
+  #endif
+
   const float spm = totalLength / current_block->step_event_count;  // (steps/mm) Distance for each step
 
   f_s = spm * current_block->initial_rate;              // (steps/s) Start feedrate
@@ -604,6 +632,14 @@ void FTMotion::makeVector() {
   #define _SET_TRAJ(q) traj.q[makeVector_batchIdx] = startPosn.q + ratio.q * dist;
   LOGICAL_AXIS_MAP_LC(_SET_TRAJ);
 
+  #if ENABLED(FTM_LEVELING)
+    if (levelFade) {
+      const float t = constrain(dist * levelOneOverLength, 0.0f, 1.0f);
+      const float zc = bedlevel.get_z_correction(levelStart + levelDist * t);
+      traj.z[makeVector_batchIdx] += levelFade * (zc - (levelZ0 + levelDZ * t));
+    }
+  #endif
+
   #if HAS_EXTRUDERS
     if (cfg.linearAdvEna) {
       float dedt_adj = (traj.e[makeVector_batchIdx] - e_raw_z1) * (FTM_FS);
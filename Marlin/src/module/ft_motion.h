@@ -157,6 +157,15 @@ class FTMotion {
     static uint32_t N1, N2, N3;
     static uint32_t max_intervals;
 
+    // Leveling along the move.
+    #if ENABLED(FTM_LEVELING)
+      static xy_pos_t levelStart,           // (mm) Machine XY at the start of the block
+                      levelDist;            // (mm) XY distance of the block
+      static float levelZ0, levelDZ,        // (mm) Z correction at the block start and its change to the end
+                   levelFade,               // (ratio) Leveling fade factor of the block. Zero for no leveling.
+                   levelOneOverLength;      // (1/mm) Reciprocal of the block length
+    #endif
+
     // Number of batches needed to propagate the current trajectory to the stepper.
     static constexpr uint32_t PROP_BATCHES = CEIL((FTM_WINDOW_SIZE) / (FTM_BATCH_SIZE)) - 1;
 
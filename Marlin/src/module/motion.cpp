@@ -70,6 +70,10 @@
   #include "../feature/babystep.h"
 #endif
 
+#if ENABLED(FTM_LEVELING)
+  #include "ft_motion.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../core/debug_out.h"
 
@@ -1288,15 +1292,22 @@ void do_blocking_move_to(const xyze_pos_t &raw, const_feedRate_t fr_mm_s/*=0.0f*
    *  - Constrain to the Z max physical position
    *  - If lowering is not allowed then skip a downward move
    *  - Execute the move at the probing (or homing) feedrate
+   *  - Without 'wait' just queue the move, so the next blocking move waits for it
    */
-  void do_z_clearance(const_float_t zclear, const bool with_probe/*=true*/, const bool lower_allowed/*=false*/) {
+  void do_z_clearance(const_float_t zclear, const bool with_probe/*=true*/, const bool lower_allowed/*=false*/, const bool wait/*=true*/) {
     UNUSED(with_probe);
     float zdest = zclear;
     TERN_(HAS_BED_PROBE, if (with_probe && probe.offset.z < 0) zdest -= probe.offset.z);
     NOMORE(zdest, Z_MAX_POS);
-    if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("do_z_clearance(", zclear, " [", current_position.z, " to ", zdest, "], ", lower_allowed, ")");
+    if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("do_z_clearance(", zclear, " [", current_position.z, " to ", zdest, "], ", lower_allowed, ", ", wait, ")");
     if ((!lower_allowed && zdest < current_position.z) || zdest == current_position.z) return;
-    do_blocking_move_to_z(zdest, TERN(HAS_BED_PROBE, z_probe_fast_mm_s, homing_feedrate(Z_AXIS)));
+    const feedRate_t fr_mm_s = TERN(HAS_BED_PROBE, z_probe_fast_mm_s, homing_feedrate(Z_AXIS));
+    if (wait)
+      do_blocking_move_to_z(zdest, fr_mm_s);
+    else {
+      current_position.z = zdest;
+      line_to_current_position(fr_mm_s);
+    }
   }
   void do_z_clearance_by(const_float_t zclear) {
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("do_z_clearance_by(", zclear, ")");
@@ -1764,6 +1775,60 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
     #define POLAR_MIN_SEGMENT_LENGTH 0.5f
   #endif
 
+  #if ENABLED(ADAPTIVE_KINEMATIC_SEGMENTS)
+
+    // Get the Cartesian position of the given joint positions into 'cartes'
+    inline void joints_to_cartes(const abce_pos_t &joints) {
+      #if ANY(DELTA, AXEL_TPARA)
+        forward_kinematics(joints.a, joints.b, joints.c);
+      #else
+        forward_kinematics(joints.a, joints.b);
+      #endif
+    }
+
+    /**
+     * Steppers move the joints linearly within a block, so halfway through a
+     * segment the machine is at the mean of the end joint positions. Return
+     * how far that point is from the middle of the straight Cartesian line.
+     */
+    float kinematic_segment_sag(const xyz_pos_t &a, const xyz_pos_t &b) {
+      inverse_kinematics(a);
+      abce_pos_t joints = delta;
+      inverse_kinematics(b);
+      joints = (joints + delta) * 0.5f;
+      joints_to_cartes(joints);
+      const xyz_pos_t sagged = cartes;
+
+      // Compare with the forward kinematics of the true midpoint to cancel offsets
+      inverse_kinematics((a + b) * 0.5f);
+      joints_to_cartes(delta);
+      return (cartes - sagged).magnitude();
+    }
+
+    /**
+     * Get the fraction of the move to use for the segment starting at 't'.
+     * Try 'guess' first, shortening it until the segment sags no more than
+     * ADAPTIVE_SEGMENT_TOLERANCE or reaches 'dt_min'. The sag grows with the
+     * square of the length, so that gives the guess for the next segment.
+     * A remainder shorter than half of 'dt_min' is merged into the segment
+     * before it is checked. The move ends when this returns 1 - t.
+     */
+    float next_segment_fraction(const xyz_pos_t &start, const xyz_float_t &diff, const_float_t t, const_float_t dt_min, const_float_t dt_max, float &guess) {
+      float dt = guess;
+      if (t + dt >= 1.0f - 0.5f * dt_min) dt = 1.0f - t;
+      for (;;) {
+        const float sag = kinematic_segment_sag(start + diff * t, start + diff * (t + dt)),
+                    scale = sag > 0 ? 0.9f * SQRT(float(ADAPTIVE_SEGMENT_TOLERANCE) / sag) : 2.0f;
+        if (sag <= float(ADAPTIVE_SEGMENT_TOLERANCE) || dt <= dt_min) {
+          guess = constrain(dt * _MIN(scale, 2.0f), dt_min, dt_max);
+          return dt;
+        }
+        dt = _MAX(dt * scale, dt_min);
+      }
+    }
+
+  #endif // ADAPTIVE_KINEMATIC_SEGMENTS
+
   /**
    * Prepare a linear move in a DELTA or SCARA setup.
    *
@@ -1832,7 +1897,6 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
 
     // The approximate length of each segment
     const float inv_segments = 1.0f / float(segments);
-    const xyze_float_t segment_distance = diff * inv_segments;
 
     // Add hints to help optimize the move
     PlannerHints hints(cartesian_mm * inv_segments);
@@ -1847,17 +1911,61 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
     SERIAL_EOL();
     //*/
 
-    // Get the current position as starting point
-    xyze_pos_t raw = current_position;
+    #if ENABLED(ADAPTIVE_KINEMATIC_SEGMENTS)
 
-    // Calculate and execute the segments
-    millis_t next_idle_ms = millis() + 200UL;
-    while (--segments) {
-      segment_idle(next_idle_ms);
-      raw += segment_distance;
-      if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
-        break;
-    }
+      // Segments are no shorter than the fixed ones and as long as the path allows
+      const xyz_pos_t start = current_position;
+      const float dt_max = _MAX(inv_segments, _MIN(1.0f, float(ADAPTIVE_SEGMENT_MAX_LENGTH) / cartesian_mm));
+      float t = 0, guess = inv_segments;
+
+      millis_t next_idle_ms = millis() + 200UL;
+      for (;;) {
+        segment_idle(next_idle_ms);
+        const float dt = next_segment_fraction(start, diff, t, inv_segments, dt_max, guess);
+        if (dt >= 1.0f - t) break;  // The checked segment reaches the destination
+        t += dt;
+        hints.millimeters = cartesian_mm * dt;
+        TERN_(FEEDRATE_SCALING, hints.inv_duration = scaled_fr_mm_s / hints.millimeters);
+        if (!planner.buffer_line(current_position + diff * t, scaled_fr_mm_s, active_extruder, hints))
+          break;
+      }
+
+      // The last segment covers the rest of the move
+      hints.millimeters = cartesian_mm * (1.0f - t);
+      TERN_(FEEDRATE_SCALING, hints.inv_duration = scaled_fr_mm_s / hints.millimeters);
+
+    #else
+
+      const xyze_float_t segment_distance = diff * inv_segments;
+
+      // Get the current position as starting point
+      xyze_pos_t raw = current_position;
+
+      #if ENABLED(DELTA_IK_BATCH)
+        // Tower columns for the next few segments
+        abc_float_t cols[DELTA_IK_BATCH_SIZE];
+        uint8_t col_index = DELTA_IK_BATCH_SIZE;
+      #endif
+
+      // Calculate and execute the segments
+      millis_t next_idle_ms = millis() + 200UL;
+      while (--segments) {
+        segment_idle(next_idle_ms);
+        raw += segment_distance;
+        #if ENABLED(DELTA_IK_BATCH)
+          if (col_index >= DELTA_IK_BATCH_SIZE) {
+            inverse_kinematics_batch(raw, segment_distance, _MIN(segments, uint16_t(DELTA_IK_BATCH_SIZE)), cols);
+            col_index = 0;
+          }
+          hints.delta_cols = &cols[col_index++];
+        #endif
+        if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
+          break;
+      }
+
+      TERN_(DELTA_IK_BATCH, hints.delta_cols = nullptr);
+
+    #endif
 
     // Ensure last segment arrives at target location.
     planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, hints);
@@ -1946,7 +2054,8 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
   inline bool line_to_destination_cartesian() {
     const float scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
     #if HAS_MESH
-      if (planner.leveling_active && planner.leveling_active_at_z(destination.z)) {
+      // FT Motion applies the mesh along the move, so a straight move stays a single block
+      if (planner.leveling_active && planner.leveling_active_at_z(destination.z) && TERN1(FTM_LEVELING, !ftMotion.cfg.active)) {
         #if ENABLED(AUTO_BED_LEVELING_UBL)
           #if UBL_SEGMENTED
             return bedlevel.line_to_destination_segmented(scaled_fr_mm_s);
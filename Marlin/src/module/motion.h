@@ -357,6 +357,11 @@ inline void prepare_internal_move_to_destination(const_feedRate_t fr_mm_s=0.0f)
   }
 #endif
 
+#if ENABLED(ADAPTIVE_KINEMATIC_SEGMENTS)
+  float kinematic_segment_sag(const xyz_pos_t &a, const xyz_pos_t &b);
+  float next_segment_fraction(const xyz_pos_t &start, const xyz_float_t &diff, const_float_t t, const_float_t dt_min, const_float_t dt_max, float &guess);
+#endif
+
 /**
  * Blocking movement and shorthand functions
  */
@@ -423,12 +428,12 @@ void restore_feedrate_and_scaling();
       #define Z_POST_CLEARANCE Z_CLEARANCE_FOR_HOMING
     #endif
   #endif
-  void do_z_clearance(const_float_t zclear, const bool with_probe=true, const bool lower_allowed=false);
+  void do_z_clearance(const_float_t zclear, const bool with_probe=true, const bool lower_allowed=false, const bool wait=true);
   void do_z_clearance_by(const_float_t zclear);
   void do_move_after_z_homing();
   inline void do_z_post_clearance() { do_z_clearance(Z_POST_CLEARANCE); }
 #else
-  inline void do_z_clearance(float, bool=true, bool=false) {}
+  inline void do_z_clearance(float, bool=true, bool=false, bool=true) {}
   inline void do_z_clearance_by(float) {}
 #endif
 
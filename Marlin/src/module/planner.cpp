@@ -2758,6 +2758,13 @@ bool Planner::_populate_block(
     block->start_position = position_float.asLogical();
   #endif
 
+  #if ENABLED(FTM_LEVELING)
+    // The ends are leveled already. FT Motion levels the points in between.
+    block->level_start = position_float;
+    block->level_end = target_float;
+    block->level_fade = leveling_active && (dist.a || dist.b) ? fade_scaling_factor_for_z(target_float.z) : 0;
+  #endif
+
   TERN_(HAS_POSITION_FLOAT, position_float = target_float);
   TERN_(GRADIENT_MIX, mixer.gradient_control(target_float.z));
 
@@ -2932,6 +2939,14 @@ bool Planner::buffer_segment(const abce_pos_t &abce
     #endif
   //*/
 
+  #if ENABLED(PREDICTIVE_HEATUP_WAIT)
+    // Extruding moves wait for heat-up deferred by M109 / M190
+    if (target.e != position.e && thermalManager.heatup_deferred()) {
+      thermalManager.finish_deferred_heatup();
+      if (cleaning_buffer_counter) return false;
+    }
+  #endif
+
   // Queue the movement. Return 'false' if the move was not queued.
   if (!_buffer_steps(target
       OPTARG(HAS_POSITION_FLOAT, target_float)
@@ -2978,7 +2993,12 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
     #endif
 
     // Cartesian XYZ to kinematic ABC, stored in global 'delta'
-    inverse_kinematics(machine);
+    #if ENABLED(DELTA_IK_BATCH)
+      if (hints.delta_cols)
+        delta.set(machine.z + hints.delta_cols->a, machine.z + hints.delta_cols->b, machine.z + hints.delta_cols->c);
+      else
+    #endif
+        inverse_kinematics(machine);
 
     PlannerHints ph = hints;
     if (!hints.millimeters)
@@ -3057,7 +3077,7 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
 
 #if ENABLED(DIRECT_STEPPING)
 
-  void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps) {
+  void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint32_t num_steps) {
     if (!last_page_step_rate) {
       kill(GET_TEXT_F(MSG_BAD_PAGE_SPEED));
       return;
@@ -290,6 +290,11 @@ typedef struct PlannerBlock {
     xyze_pos_t start_position;
   #endif
 
+  #if ENABLED(FTM_LEVELING)
+    xy_pos_t level_start, level_end;        // (mm) Machine XY at the ends of the move, for leveling along the move
+    float level_fade;                       // Leveling fade factor for the move. Zero for no leveling.
+  #endif
+
   #if ENABLED(LASER_FEATURE)
     block_laser_t laser;
   #endif
@@ -298,7 +303,7 @@ typedef struct PlannerBlock {
 
 } block_t;
 
-#if ANY(LIN_ADVANCE, FEEDRATE_SCALING, GRADIENT_MIX, LCD_SHOW_E_TOTAL, POWER_LOSS_RECOVERY)
+#if ANY(LIN_ADVANCE, FEEDRATE_SCALING, GRADIENT_MIX, LCD_SHOW_E_TOTAL, POWER_LOSS_RECOVERY, FTM_LEVELING)
   #define HAS_POSITION_FLOAT 1
 #endif
 
@@ -414,6 +419,9 @@ struct PlannerHints {
                                       // would calculate if it knew the as-yet-unbuffered path
   #endif
 
+  #if ENABLED(DELTA_IK_BATCH)
+    const abc_float_t *delta_cols = nullptr; // Tower columns of the segment, if already computed
+  #endif
   #if HAS_ROTATIONAL_AXES
     bool cartesian_move = true;       // True if linear motion of the tool centerpoint relative to the workpiece occurs.
                                       // False if no movement of the tool center point relative to the work piece occurs
@@ -920,7 +928,7 @@ class Planner {
     );
 
     #if ENABLED(DIRECT_STEPPING)
-      static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
+      static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint32_t num_steps);
     #endif
 
     /**
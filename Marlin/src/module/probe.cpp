@@ -924,6 +924,28 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const_float_t z_min_p
 
 #endif
 
+#if ENABLED(Z_CLEARANCE_FROM_BED)
+  // Z after the last raise from a measured point, to tell if the next XY travel may start from there
+  static float bed_clearance_z = NAN;
+  // The last measured point, and the steepest bed slope between points measured in a row
+  static xy_pos_t bed_last_xy;
+  static float bed_last_z = NAN, bed_slope = NAN;
+
+  // Note a measured point. Start a new row after any other move.
+  static void bed_point_measured(const xy_pos_t &xy, const_float_t z, const bool in_row) {
+    if (!in_row) bed_slope = NAN;
+    else if (!isnan(bed_last_z)) {
+      const float d = (xy - bed_last_xy).magnitude();
+      if (d > 0) {
+        const float m = ABS(z - bed_last_z) / d;
+        if (isnan(bed_slope) || m > bed_slope) bed_slope = m;
+      }
+    }
+    bed_last_xy = xy;
+    bed_last_z = z;
+  }
+#endif
+
 /**
  * - Move to the given XY
  * - Deploy the probe, if not already deployed
@@ -962,7 +984,19 @@ float Probe::probe_at_point(
   }
 
   // Use a safe Z height for the XY move
-  const float safe_z = _MAX(current_position.z, z_clearance);
+  #if ENABLED(Z_CLEARANCE_FROM_BED)
+    // Still at the clearance above the last measured point? The next point may be higher,
+    // so add the most the bed could rise over the travel at the steepest slope seen so far.
+    // Without a slope yet use the usual clearance.
+    const xy_pos_t bed_xy = { rx, ry };
+    const bool in_row = current_position.z == bed_clearance_z;
+    const float safe_z = in_row && !isnan(bed_slope)
+      ? _MIN(current_position.z + bed_slope * (bed_xy - bed_last_xy).magnitude(), float(Z_MAX_POS))
+      : _MAX(current_position.z, z_clearance);
+    bed_clearance_z = NAN;
+  #else
+    const float safe_z = _MAX(current_position.z, z_clearance);
+  #endif
 
   // On delta keep Z below clip height or do_blocking_move_to will abort
   xyz_pos_t npos = NUM_AXIS_ARRAY(
@@ -1012,12 +1046,19 @@ float Probe::probe_at_point(
     if (!isnan(measured_z)) {
       switch (raise_after) {
         default: break;
-        case PROBE_PT_RAISE:
-          if (raise_after_is_rel)
-            do_z_clearance_by(z_clearance);
-          else
-            do_z_clearance(z_clearance);
-          break;
+        case PROBE_PT_RAISE: {
+          const float zclear = raise_after_is_rel ? current_position.z + z_clearance
+                                                  : z_clearance + TERN0(Z_CLEARANCE_FROM_BED, measured_z);
+          // With PROBE_QUEUE_RAISE the travel to the next point waits for the raise,
+          // so the bookkeeping below overlaps it.
+          do_z_clearance(zclear, !raise_after_is_rel, false, DISABLED(PROBE_QUEUE_RAISE));
+          #if ENABLED(Z_CLEARANCE_FROM_BED)
+            if (!raise_after_is_rel) {
+              bed_point_measured(bed_xy, measured_z, in_row);
+              bed_clearance_z = current_position.z;
+            }
+          #endif
+        } break;
         case PROBE_PT_STOW: case PROBE_PT_LAST_STOW:
           if (stow()) measured_z = NAN;   // Error on stow?
           break;
@@ -299,7 +299,7 @@ typedef struct SettingsDataStruct {
   uint16_t grid_check;                                  // Hash to check against X/Y
   xy_pos_t bilinear_grid_spacing, bilinear_start;       // G29 L F
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
-    bed_mesh_t z_values;                                // G29
+    TERN(OPTIMIZED_MESH_STORAGE, mesh_store_t, bed_mesh_t) z_values; // G29
   #else
     float z_values[3][3];
   #endif
@@ -1065,8 +1065,12 @@ void MarlinSettings::postprocess() {
         EEPROM_WRITE(bilinear_start);
       #endif
 
-      #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
-        EEPROM_WRITE(bedlevel.z_values);              // 9-256 floats
+      #if ALL(AUTO_BED_LEVELING_BILINEAR, OPTIMIZED_MESH_STORAGE)
+        mesh_store_t z_mesh_store;
+        set_store_from_mesh(bedlevel.z_values, z_mesh_store);
+        EEPROM_WRITE(z_mesh_store);                   // 9-65025 shorts
+      #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
+        EEPROM_WRITE(bedlevel.z_values);              // 9-65025 floats
       #else
         dummyf = 0;
         for (uint16_t q = grid_max_x * grid_max_y; q--;) EEPROM_WRITE(dummyf);
@@ -2131,7 +2135,13 @@ void MarlinSettings::postprocess() {
           if (grid_max_x == (GRID_MAX_POINTS_X) && grid_max_y == (GRID_MAX_POINTS_Y)) {
             if (!validating) set_bed_leveling_enabled(false);
             bedlevel.set_grid(spacing, start);
-            EEPROM_READ(bedlevel.z_values);            // 9 to 256 floats
+            #if ENABLED(OPTIMIZED_MESH_STORAGE)
+              mesh_store_t z_mesh_store;
+              EEPROM_READ(z_mesh_store);               // 9 to 65025 shorts
+              if (!validating) set_mesh_from_store(z_mesh_store, bedlevel.z_values);
+            #else
+              EEPROM_READ(bedlevel.z_values);          // 9 to 65025 floats
+            #endif
           }
           else if (grid_max_x > (GRID_MAX_POINTS_X) || grid_max_y > (GRID_MAX_POINTS_Y)) {
             eeprom_error = ERR_EEPROM_CORRUPT;
@@ -2141,7 +2151,12 @@ void MarlinSettings::postprocess() {
         #endif // AUTO_BED_LEVELING_BILINEAR
           {
             // Skip past disabled (or stale) Bilinear Grid data
-            for (uint16_t q = grid_max_x * grid_max_y; q--;) EEPROM_READ(dummyf);
+            #if ALL(AUTO_BED_LEVELING_BILINEAR, OPTIMIZED_MESH_STORAGE)
+              int16_t dummys;
+              for (uint16_t q = grid_max_x * grid_max_y; q--;) EEPROM_READ(dummys);
+            #else
+              for (uint16_t q = grid_max_x * grid_max_y; q--;) EEPROM_READ(dummyf);
+            #endif
           }
       }
 
@@ -3165,7 +3180,7 @@ void MarlinSettings::postprocess() {
 
         #if ENABLED(OPTIMIZED_MESH_STORAGE)
           int16_t z_mesh_store[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
-          bedlevel.set_store_from_mesh(bedlevel.z_values, z_mesh_store);
+          set_store_from_mesh(bedlevel.z_values, z_mesh_store);
           uint8_t * const src = (uint8_t*)&z_mesh_store;
         #else
           uint8_t * const src = (uint8_t*)&bedlevel.z_values;
@@ -3213,11 +3228,11 @@ void MarlinSettings::postprocess() {
         #if ENABLED(OPTIMIZED_MESH_STORAGE)
           if (into) {
             float z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
-            bedlevel.set_mesh_from_store(z_mesh_store, z_values);
+            set_mesh_from_store(z_mesh_store, z_values);
             memcpy(into, z_values, sizeof(z_values));
           }
           else
-            bedlevel.set_mesh_from_store(z_mesh_store, bedlevel.z_values);
+            set_mesh_from_store(z_mesh_store, bedlevel.z_values);
         #endif
 
         #if ENABLED(DWIN_LCD_PROUI)
@@ -1952,6 +1952,28 @@ void Stepper::pulse_phase_isr() {
 
           page_step_state.segment_idx++;
 
+        #elif STEPPER_PAGE_FORMAT == SP_4xND
+
+          #define PAGE_PULSE_PREP(AXIS, NBIT) step_needed.set(_AXIS(AXIS), TEST(steps, NBIT))
+          #define PAGE_DIR_UPDATE(AXIS, NBIT) dm[_AXIS(AXIS)] = TEST(page_step_state.dir, NBIT)
+
+          const bool new_segment = !page_step_state.segment_steps;
+          const uint8_t steps = DirectStepping::page_step_bits(page_step_state);
+
+          if (new_segment) {
+            AxisBits dm = last_direction_bits;
+            PAGE_DIR_UPDATE(X, 3);
+            PAGE_DIR_UPDATE(Y, 2);
+            PAGE_DIR_UPDATE(Z, 1);
+            TERN_(HAS_EXTRUDERS, PAGE_DIR_UPDATE(E, 0));
+            if (dm != last_direction_bits) set_directions(dm);
+          }
+
+          PAGE_PULSE_PREP(X, 3);
+          PAGE_PULSE_PREP(Y, 2);
+          PAGE_PULSE_PREP(Z, 1);
+          TERN_(HAS_EXTRUDERS, PAGE_PULSE_PREP(E, 0));
+
         #else
           #error "Unknown direct stepping page format!"
         #endif
@@ -2416,10 +2438,17 @@ hal_timer_t Stepper::block_phase_isr() {
         #endif
 
         if (current_block->is_page()) {
-          PAGE_SEGMENT_UPDATE_POS(X);
-          PAGE_SEGMENT_UPDATE_POS(Y);
-          PAGE_SEGMENT_UPDATE_POS(Z);
-          PAGE_SEGMENT_UPDATE_POS(E);
+          #if STEPPER_PAGE_FORMAT == SP_4xND
+            count_position.x += page_step_state.delta[0];
+            count_position.y += page_step_state.delta[1];
+            count_position.z += page_step_state.delta[2];
+            TERN_(HAS_EXTRUDERS, count_position.e += page_step_state.delta[3]);
+          #else
+            PAGE_SEGMENT_UPDATE_POS(X);
+            PAGE_SEGMENT_UPDATE_POS(Y);
+            PAGE_SEGMENT_UPDATE_POS(Z);
+            PAGE_SEGMENT_UPDATE_POS(E);
+          #endif
         }
       #endif
       TERN_(HAS_FILAMENT_RUNOUT_DISTANCE, runout.block_completed(current_block));
@@ -2674,6 +2703,12 @@ hal_timer_t Stepper::block_phase_isr() {
           page_step_state.segment_idx = 0;
           page_step_state.page = page_manager.get_page(current_block->page_idx);
           page_step_state.bd.reset();
+          #if STEPPER_PAGE_FORMAT == SP_4xND
+            page_step_state.bits = page_manager.get_page_bits(current_block->page_idx);
+            page_step_state.dir = (last_direction_bits.x ? 8 : 0) | (last_direction_bits.y ? 4 : 0)
+                                | (last_direction_bits.z ? 2 : 0) | TERN0(HAS_EXTRUDERS, last_direction_bits.e ? 1 : 0);
+            ZERO(page_step_state.delta);
+          #endif
 
           if (DirectStepping::Config::DIRECTIONAL)
             current_block->direction_bits = last_direction_bits;
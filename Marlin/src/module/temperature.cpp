@@ -72,6 +72,10 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(AUTO_REPORT_TEMPERATURES_BINARY)
+  #include "../libs/crc16.h"
+#endif
+
 #ifndef TEMP_SENSOR_0
   #define TEMP_SENSOR_0 0
 #endif
@@ -216,6 +220,10 @@
   #include "../feature/power_monitor.h"
 #endif
 
+#if ENABLED(THERMAL_HISTORY)
+  #include "../feature/thermal_history.h"
+#endif
+
 #if ENABLED(EMERGENCY_PARSER)
   #include "../feature/e_parser.h"
 #endif
@@ -648,6 +656,13 @@ volatile bool Temperature::raw_temps_ready = false;
   millis_t Temperature::preheat_end_ms_bed = 0;
 #endif
 
+#if ENABLED(PREDICTIVE_HEATUP_WAIT)
+  Flags<HOTENDS> Temperature::deferred_hotend; // = { 0 }
+  #if HAS_HEATED_BED
+    bool Temperature::deferred_bed; // = false
+  #endif
+#endif
+
 #if HAS_FAN_LOGIC
   constexpr millis_t Temperature::fan_update_interval_ms;
   millis_t Temperature::fan_update_ms = 0;
@@ -1499,6 +1514,9 @@ int16_t Temperature::getHeaterPower(const heater_id_t heater_id) {
 inline void loud_kill(FSTR_P const lcd_msg, const heater_id_t heater_id) {
   marlin_state = MarlinState::MF_KILLED;
   thermalManager.disable_all_heaters();
+  #if ALL(THERMAL_HISTORY, HAS_MEDIA)
+    if (thermal_history.save()) SERIAL_ECHOLNPGM("Thermal history saved to " THERMAL_HISTORY_FILE);
+  #endif
   #if HAS_BEEPER
     for (uint8_t i = 20; i--;) {
       hal.watchdog_refresh();
@@ -2748,6 +2766,7 @@ void Temperature::updateTemperaturesFromRawValues() {
 
   TERN_(FILAMENT_WIDTH_SENSOR, filwidth.update_measured_mm());
   TERN_(HAS_POWER_MONITOR,     power_monitor.capture_values());
+  TERN_(THERMAL_HISTORY,       thermal_history.record());
 
   #if HAS_HOTEND
     #define _TEMPDIR(N) TEMP_SENSOR_IS_ANY_MAX_TC(N) ? 0 : TEMPDIR(N),
@@ -4538,9 +4557,146 @@ void Temperature::isr() {
     AutoReporter<Temperature::AutoReportTemp> Temperature::auto_reporter;
     void Temperature::AutoReportTemp::report() {
       if (wait_for_heatup) return;
+      #if ALL(AUTO_REPORT_TEMPERATURES_BINARY, HAS_MULTI_SERIAL)
+        SerialMask text_ports = multiSerial.portMask;
+      #endif
+      #if ENABLED(AUTO_REPORT_TEMPERATURES_BINARY)
+        if (binary_report_ports) {
+          #if HAS_MULTI_SERIAL
+            // Binary frames to ports that asked for them, text to the rest
+            const SerialMask binary_ports(binary_report_ports);
+            {
+              PORT_REDIRECT(text_ports.intersect(binary_ports));
+              report_binary();
+            }
+            text_ports = text_ports.exclude(binary_ports);
+            if (!text_ports.enabled(SerialMask::All)) return;
+          #else
+            return report_binary();
+          #endif
+        }
+        #if HAS_MULTI_SERIAL
+          PORT_REDIRECT(text_ports);
+        #endif
+      #endif
       print_heater_states(active_extruder OPTARG(HAS_TEMP_REDUNDANT, ENABLED(AUTO_REPORT_REDUNDANT)));
       SERIAL_EOL();
     }
+
+    #if ENABLED(AUTO_REPORT_TEMPERATURES_BINARY)
+
+      #define BINARY_TEMP_SLOTS 15
+      #define BINARY_TEMP_MARKER 0xFD
+
+      typedef struct { int16_t temp, target; uint8_t power; } binary_temp_t;
+
+      uint8_t Temperature::binary_report_ports; // = 0
+      static binary_temp_t binary_last[BINARY_TEMP_SLOTS];
+      static uint8_t binary_seq, binary_since_key;
+      static bool binary_resync;
+
+      void Temperature::set_binary_report(const serial_index_t port, const bool onoff) {
+        if (!port.valid()) return;
+        if (onoff) {
+          SBI(binary_report_ports, port.index);
+          binary_resync = true;
+        }
+        else
+          CBI(binary_report_ports, port.index);
+      }
+
+      /**
+       * Send a binary temperature report frame:
+       *   0xFD, <length>, <payload>, <CRC16 of payload, little-endian>
+       *
+       * 0xFD never occurs in UTF-8 text, so hosts can find frames among other output.
+       *
+       * Payload:
+       *   <flags>    : Bit 7 set for a key frame with all values, bits 0-6 frame sequence
+       *   <slots>    : uint16 mask of the sensors that follow, in slot order
+       *   For each sensor:
+       *     <fields> : Bit 0 temperature, bit 1 target, bit 2 power,
+       *                bit 3 temperature is an int8 delta from the previous report
+       *     [temp]   : int16 (0.1°C) or int8 delta (0.1°C)
+       *     [target] : int16 (°C)
+       *     [power]  : uint8 heater power
+       *
+       * Slots: 0-7 Hotends, 8 Bed, 9 Chamber, 10 Cooler, 11 Probe, 12 Board, 13 SoC, 14 Redundant
+       *
+       * Nothing is sent if no values changed and no key frame is due.
+       */
+      void Temperature::report_binary() {
+        binary_temp_t now[BINARY_TEMP_SLOTS];
+        uint16_t present = 0;
+        auto put = [&](const uint8_t slot, const_celsius_float_t c, const celsius_t t, const int16_t p) {
+          now[slot] = { int16_t(LROUND(c * 10)), t, uint8_t(p) };
+          SBI(present, slot);
+        };
+
+        #if HAS_TEMP_HOTEND
+          HOTEND_LOOP() put(e, degHotend(e), degTargetHotend(e), getHeaterPower((heater_id_t)e));
+        #endif
+        TERN_(HAS_HEATED_BED,   put(8, degBed(), degTargetBed(), getHeaterPower(H_BED)));
+        TERN_(HAS_TEMP_CHAMBER, put(9, degChamber(), TERN0(HAS_HEATED_CHAMBER, degTargetChamber()), TERN0(HAS_HEATED_CHAMBER, getHeaterPower(H_CHAMBER))));
+        TERN_(HAS_TEMP_COOLER,  put(10, degCooler(), TERN0(HAS_COOLER, degTargetCooler()), TERN0(HAS_COOLER, getHeaterPower(H_COOLER))));
+        TERN_(HAS_TEMP_PROBE,   put(11, degProbe(), 0, 0));
+        TERN_(HAS_TEMP_BOARD,   put(12, degBoard(), 0, 0));
+        TERN_(HAS_TEMP_SOC,     put(13, degSoc(), 0, 0));
+        #if ALL(HAS_TEMP_REDUNDANT, AUTO_REPORT_REDUNDANT)
+          put(14, degRedundant(), celsius_t(degRedundantTarget()), 0);
+        #endif
+
+        const bool key = binary_resync || binary_since_key >= (AUTO_REPORT_BINARY_KEYFRAME) - 1;
+
+        uint8_t frame[5 + BINARY_TEMP_SLOTS * 6], *p = &frame[5];
+        uint16_t slots = 0;
+        for (uint8_t s = 0; s < BINARY_TEMP_SLOTS; ++s) {
+          if (!TEST(present, s)) continue;
+          const binary_temp_t &n = now[s];
+          binary_temp_t &o = binary_last[s];
+          uint8_t fields = key ? 0b111 : (n.temp != o.temp ? 0b001 : 0) | (n.target != o.target ? 0b010 : 0) | (n.power != o.power ? 0b100 : 0);
+          if (!fields) continue;
+          const int16_t dt = n.temp - o.temp;
+          if (!key && (fields & 0b001) && WITHIN(dt, -128, 127)) fields |= 0b1000;
+          SBI(slots, s);
+          *p++ = fields;
+          if (fields & 0b1000)
+            *p++ = uint8_t(int8_t(dt));
+          else if (fields & 0b001) {
+            *p++ = uint8_t(n.temp);
+            *p++ = uint8_t(n.temp >> 8);
+          }
+          if (fields & 0b010) {
+            *p++ = uint8_t(n.target);
+            *p++ = uint8_t(n.target >> 8);
+          }
+          if (fields & 0b100) *p++ = n.power;
+          o = n;
+        }
+
+        if (key) {
+          binary_resync = false;
+          binary_since_key = 0;
+        }
+        else {
+          ++binary_since_key;
+          if (!slots) return;
+        }
+
+        frame[0] = BINARY_TEMP_MARKER;
+        frame[1] = uint8_t(p - &frame[2]);
+        frame[2] = (key ? 0x80 : 0) | (binary_seq++ & 0x7F);
+        frame[3] = uint8_t(slots);
+        frame[4] = uint8_t(slots >> 8);
+
+        uint16_t crc = 0;
+        crc16(&crc, &frame[2], frame[1]);
+        for (uint8_t *b = frame; b < p; ++b) SERIAL_CHAR(*b);
+        SERIAL_CHAR(uint8_t(crc), uint8_t(crc >> 8));
+      }
+
+    #endif // AUTO_REPORT_TEMPERATURES_BINARY
+
   #endif
 
   #if HAS_HOTEND && HAS_STATUS_MESSAGE
@@ -4574,13 +4730,46 @@ void Temperature::isr() {
       #define MIN_COOLING_SLOPE_TIME 60
     #endif
 
+    #if ALL(PREDICTIVE_HEATUP_WAIT, MPCTEMP)
+
+      /**
+       * Use the MPC model to predict the seconds for hotend 'e' to reach its target
+       * with the heater at full power. The modeled block temperature approaches the
+       * full-power equilibrium exponentially, and the sensor lags the block.
+       */
+      float Temperature::mpc_heatup_eta(const uint8_t e) {
+        const MPCHeaterInfo &hotend = temp_hotend[e];
+        const MPC_t &mpc = hotend.mpc;
+        const float target = hotend.target;
+        if (hotend.modeled_block_temp >= target) return 0.0f;
+
+        const float power = mpc.heater_power * (MPC_MAX) / 255,
+                    t_eq = hotend.modeled_ambient_temp + power / mpc.ambient_xfer_coeff_fan0;
+        if (t_eq <= target) return __FLT_MAX__;   // Unreachable according to the model
+
+        const float tau = mpc.block_heat_capacity / mpc.ambient_xfer_coeff_fan0;
+        return tau * logf((t_eq - hotend.modeled_block_temp) / (t_eq - target)) + RECIPROCAL(mpc.sensor_responsiveness);
+      }
+
+    #endif
+
     bool Temperature::wait_for_hotend(const uint8_t target_extruder, const bool no_wait_for_cooling/*=true*/
       OPTARG(G26_CLICK_CAN_CANCEL, const bool click_to_cancel/*=false*/)
+      OPTARG(PREDICTIVE_HEATUP_WAIT, const uint16_t lead_s/*=0*/)
     ) {
       #if ENABLED(AUTOTEMP)
         REMEMBER(1, planner.autotemp.enabled, false);
       #endif
 
+      #if ENABLED(PREDICTIVE_HEATUP_WAIT)
+        deferred_hotend.clear(target_extruder);
+        bool deferred = false;
+        #if DISABLED(MPCTEMP)
+          heatup_rate_t heatup;
+          heatup.reset();
+        #endif
+      #endif
+
       #if TEMP_RESIDENCY_TIME > 0
         millis_t residency_start_ms = 0;
         bool first_loop = true;
@@ -4617,6 +4806,9 @@ void Temperature::isr() {
         now = millis();
         if (ELAPSED(now, next_temp_ms)) { // Print temp & remaining time every 1s while waiting
           next_temp_ms = now + 1000UL;
+          #if ENABLED(PREDICTIVE_HEATUP_WAIT) && DISABLED(MPCTEMP)
+            heatup.update(degHotend(target_extruder), now);
+          #endif
           print_heater_states(target_extruder);
           #if TEMP_RESIDENCY_TIME > 0
             SString<20> s(F(" W:"));
@@ -4657,6 +4849,14 @@ void Temperature::isr() {
 
         #endif
 
+        #if ENABLED(PREDICTIVE_HEATUP_WAIT)
+          // Leave the rest of the wait to the first extruding move
+          if (lead_s && !wants_to_cool) {
+            const float eta = TERN(MPCTEMP, mpc_heatup_eta(target_extruder), heatup.eta(temp, target_temp));
+            if (eta <= lead_s) { deferred = true; break; }
+          }
+        #endif
+
         // Prevent a wait-forever situation if R is misused i.e. M109 R0
         if (wants_to_cool) {
           // Break after MIN_COOLING_SLOPE_TIME seconds
@@ -4677,6 +4877,14 @@ void Temperature::isr() {
 
       } while (wait_for_heatup && TEMP_CONDITIONS);
 
+      #if ENABLED(PREDICTIVE_HEATUP_WAIT)
+        if (deferred) {
+          wait_for_heatup = false;
+          deferred_hotend.set(target_extruder);
+          return false;
+        }
+      #endif
+
       // If wait_for_heatup is set, temperature was reached, no cancel
       if (wait_for_heatup) {
         wait_for_heatup = false;
@@ -4722,7 +4930,15 @@ void Temperature::isr() {
 
     bool Temperature::wait_for_bed(const bool no_wait_for_cooling/*=true*/
       OPTARG(G26_CLICK_CAN_CANCEL, const bool click_to_cancel/*=false*/)
+      OPTARG(PREDICTIVE_HEATUP_WAIT, const uint16_t lead_s/*=0*/)
     ) {
+      #if ENABLED(PREDICTIVE_HEATUP_WAIT)
+        deferred_bed = false;
+        bool deferred = false;
+        heatup_rate_t heatup;
+        heatup.reset();
+      #endif
+
       #if TEMP_BED_RESIDENCY_TIME > 0
         millis_t residency_start_ms = 0;
         bool first_loop = true;
@@ -4759,6 +4975,7 @@ void Temperature::isr() {
         now = millis();
         if (ELAPSED(now, next_temp_ms)) { //Print Temp Reading every 1 second while heating up.
           next_temp_ms = now + 1000UL;
+          TERN_(PREDICTIVE_HEATUP_WAIT, heatup.update(degBed(), now));
           print_heater_states(active_extruder);
           #if TEMP_BED_RESIDENCY_TIME > 0
             SString<20> s(F(" W:"));
@@ -4797,6 +5014,14 @@ void Temperature::isr() {
 
         #endif // TEMP_BED_RESIDENCY_TIME > 0
 
+        #if ENABLED(PREDICTIVE_HEATUP_WAIT)
+          // Leave the rest of the wait to the first extruding move
+          if (lead_s && !wants_to_cool && heatup.eta(temp, target_temp) <= lead_s) {
+            deferred = true;
+            break;
+          }
+        #endif
+
         // Prevent a wait-forever situation if R is misused i.e. M190 R0
         if (wants_to_cool) {
           // Break after MIN_COOLING_SLOPE_TIME_BED seconds
@@ -4821,6 +5046,14 @@ void Temperature::isr() {
 
       } while (wait_for_heatup && TEMP_BED_CONDITIONS);
 
+      #if ENABLED(PREDICTIVE_HEATUP_WAIT)
+        if (deferred) {
+          wait_for_heatup = false;
+          deferred_bed = true;
+          return false;
+        }
+      #endif
+
       // If wait_for_heatup is set, temperature was reached, no cancel
       if (wait_for_heatup) {
         wait_for_heatup = false;
@@ -4842,6 +5075,35 @@ void Temperature::isr() {
 
   #endif // HAS_HEATED_BED
 
+  #if ENABLED(PREDICTIVE_HEATUP_WAIT)
+
+    /**
+     * Finish the heat-up waits that M109 / M190 deferred.
+     * Called before queuing the first move that extrudes.
+     */
+    void Temperature::finish_deferred_heatup() {
+      #if HAS_HEATED_BED
+        if (deferred_bed) {
+          deferred_bed = false;
+          SERIAL_ECHOLNPGM("Wait for bed heating...");
+          LCD_MESSAGE(MSG_BED_HEATING);
+          wait_for_bed();
+          ui.reset_status();
+        }
+      #endif
+      #if HAS_TEMP_HOTEND
+        HOTEND_LOOP() if (deferred_hotend[e]) {
+          deferred_hotend.clear(e);
+          SERIAL_ECHOLNPGM("Wait for hotend heating...");
+          LCD_MESSAGE(MSG_HEATING);
+          wait_for_hotend(e);
+          ui.reset_status();
+        }
+      #endif
+    }
+
+  #endif // PREDICTIVE_HEATUP_WAIT
+
   #if HAS_TEMP_PROBE
 
     #ifndef MIN_DELTA_SLOPE_DEG_PROBE
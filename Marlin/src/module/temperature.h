@@ -410,6 +410,29 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
   #define G26_CLICK_CAN_CANCEL 1
 #endif
 
+#if ENABLED(PREDICTIVE_HEATUP_WAIT)
+  // Measured rate of rise, used to predict the time for a heater to reach its target
+  typedef struct HeatupRate {
+    celsius_float_t last_temp;
+    millis_t last_ms;
+    float rate;                                 // (K/s) Smoothed rate of rise
+    void reset() { last_ms = 0; rate = 0.0f; }
+    void update(const celsius_float_t temp, const millis_t ms) {
+      if (last_ms && ms != last_ms) {
+        const float r = (temp - last_temp) * 1000.0f / (ms - last_ms);
+        rate = rate ? (rate + r) * 0.5f : r;
+      }
+      last_temp = temp;
+      last_ms = ms;
+    }
+    // Seconds until the target is reached at the current rate (FLT_MAX if not heating)
+    float eta(const celsius_float_t temp, const celsius_float_t target) const {
+      if (temp >= target) return 0.0f;
+      return rate > 0.05f ? (target - temp) / rate : __FLT_MAX__;
+    }
+  } heatup_rate_t;
+#endif
+
 // A temperature sensor
 typedef struct TempInfo {
   private:
@@ -600,6 +623,9 @@ typedef struct { raw_adc_t raw_min, raw_max; celsius_t mintemp, maxtemp; } temp_
 #endif
 
 class Temperature {
+  #if ENABLED(THERMAL_HISTORY)
+    friend class ThermalHistory;
+  #endif
 
   public:
 
@@ -940,6 +966,19 @@ class Temperature {
      */
     static void task();
 
+    #if ENABLED(PREDICTIVE_HEATUP_WAIT)
+      /**
+       * Heaters whose M109 / M190 wait returned early.
+       * The first extruding move finishes these waits.
+       */
+      static Flags<HOTENDS> deferred_hotend;
+      #if HAS_HEATED_BED
+        static bool deferred_bed;
+      #endif
+      static bool heatup_deferred() { return deferred_hotend || TERN0(HAS_HEATED_BED, deferred_bed); }
+      static void finish_deferred_heatup();
+    #endif
+
     /**
      * Preheating hotends & bed
      */
@@ -1008,6 +1047,7 @@ class Temperature {
             start_hotend_preheat_time(ee);
         #endif
         TERN_(AUTO_POWER_CONTROL, if (celsius) powerManager.power_on());
+        TERN_(PREDICTIVE_HEATUP_WAIT, deferred_hotend.clear(ee)); // A new target replaces a deferred M109
         temp_hotend[ee].target = _MIN(celsius, hotend_max_target(ee));
         start_watching_hotend(ee);
       }
@@ -1023,8 +1063,13 @@ class Temperature {
       #if HAS_TEMP_HOTEND
         static bool wait_for_hotend(const uint8_t target_extruder, const bool no_wait_for_cooling=true
           OPTARG(G26_CLICK_CAN_CANCEL, const bool click_to_cancel=false)
+          OPTARG(PREDICTIVE_HEATUP_WAIT, const uint16_t lead_s=0)
         );
 
+        #if ALL(PREDICTIVE_HEATUP_WAIT, MPCTEMP)
+          static float mpc_heatup_eta(const uint8_t e);
+        #endif
+
         #if ENABLED(WAIT_FOR_HOTEND)
           static void wait_for_hotend_heating(const uint8_t target_extruder);
         #endif
@@ -1075,12 +1120,14 @@ class Temperature {
             start_bed_preheat_time();
         #endif
         TERN_(AUTO_POWER_CONTROL, if (celsius) powerManager.power_on());
+        TERN_(PREDICTIVE_HEATUP_WAIT, deferred_bed = false); // A new target replaces a deferred M190
         temp_bed.target = _MIN(celsius, BED_MAX_TARGET);
         start_watching_bed();
       }
 
       static bool wait_for_bed(const bool no_wait_for_cooling=true
         OPTARG(G26_CLICK_CAN_CANCEL, const bool click_to_cancel=false)
+        OPTARG(PREDICTIVE_HEATUP_WAIT, const uint16_t lead_s=0)
       );
 
       static void wait_for_bed_heating();
@@ -1325,6 +1372,11 @@ class Temperature {
       #if ENABLED(AUTO_REPORT_TEMPERATURES)
         struct AutoReportTemp { static void report(); };
         static AutoReporter<AutoReportTemp> auto_reporter;
+        #if ENABLED(AUTO_REPORT_TEMPERATURES_BINARY)
+          static uint8_t binary_report_ports;   // Serial ports (bits) getting binary reports
+          static void set_binary_report(const serial_index_t port, const bool onoff);
+          static void report_binary();
+        #endif
       #endif
     #endif
 
@@ -45,6 +45,42 @@ SdBaseFile *SdBaseFile::cwd_ = 0;   // Pointer to Current Working Directory
 // callback function for date/time
 void (*SdBaseFile::dateTime_)(uint16_t *date, uint16_t *time) = 0;
 
+#ifdef SD_SEEK_INDEX_SIZE
+
+  SdBaseFile::seek_index_t SdBaseFile::seekIndex; // = { 0 }
+
+  /**
+   * Start indexing this file, if it has more clusters than the index has
+   * checkpoints. Smaller files are cheap enough to follow from the start.
+   * Return true if the index belongs to this file.
+   */
+  bool SdBaseFile::seekIndexClaim() {
+    if (seekIndexOwned()) return true;
+    if (!isFile() || !firstCluster_ || !fileSize_) return false;
+    const uint32_t count = ((fileSize_ - 1) >> (vol_->clusterSizeShift_ + 9)) + 1;
+    if (count <= SD_SEEK_INDEX_SIZE) return false;
+    ZERO(seekIndex.cluster);
+    seekIndex.vol = vol_;
+    seekIndex.firstCluster = seekIndex.cluster[0] = firstCluster_;
+    seekIndex.contiguous = 0;
+    seekIndex.stride = (count + SD_SEEK_INDEX_SIZE - 1) / (SD_SEEK_INDEX_SIZE);
+    return true;
+  }
+
+  /**
+   * Record that cluster index n of this file is the given cluster
+   */
+  void SdBaseFile::seekIndexNote(const uint32_t n, const uint32_t cluster) {
+    if (!seekIndexOwned()) return;
+    if (n == seekIndex.contiguous + 1 && cluster == firstCluster_ + n) seekIndex.contiguous = n;
+    if (n % seekIndex.stride == 0) {
+      const uint32_t i = n / seekIndex.stride;
+      if (i < SD_SEEK_INDEX_SIZE) seekIndex.cluster[i] = cluster;
+    }
+  }
+
+#endif // SD_SEEK_INDEX_SIZE
+
 // add a cluster to a file
 bool SdBaseFile::addCluster() {
   if (ENABLED(SDCARD_READONLY)) return false;
@@ -1386,10 +1422,15 @@ int16_t SdBaseFile::read(void * const buf, uint16_t nbyte) {
       uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
       if (offset == 0 && blockOfCluster == 0) {
         // start of new cluster
-        if (curPosition_ == 0)
+        if (curPosition_ == 0) {
           curCluster_ = firstCluster_;                      // use first cluster in file
-        else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
-          return -1;
+          TERN_(SD_SEEK_INDEX_SIZE, seekIndexClaim());
+        }
+        else {
+          if (!vol_->fatGet(curCluster_, &curCluster_))     // get next cluster from FAT
+            return -1;
+          TERN_(SD_SEEK_INDEX_SIZE, seekIndexNote(curPosition_ >> (vol_->clusterSizeShift_ + 9), curCluster_));
+        }
       }
       block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
     }
@@ -1400,6 +1441,27 @@ int16_t SdBaseFile::read(void * const buf, uint16_t nbyte) {
 
     // no buffering needed if n == 512
     if (n == 512 && block != vol_->cacheBlockNumber()) {
+      #ifdef SD_READ_AHEAD_BLOCKS
+        // Get all the whole blocks left in this cluster with one multi-block read
+        uint8_t nb = 1;
+        if (type_ != FAT_FILE_TYPE_ROOT_FIXED) {
+          nb = _MIN(toRead >> 9, vol_->blocksPerCluster() - vol_->blockOfCluster(curPosition_));
+          // Stop short of the cached block, which may be newer than the card
+          const uint32_t cached = vol_->cacheBlockNumber();
+          if (cached > block && cached < block + nb) nb = cached - block;
+        }
+        if (nb > 1) {
+          DiskIODriver * const card = vol_->sdCard();
+          bool ok = card->readStart(block);
+          for (uint8_t i = 0; ok && i < nb; ++i) ok = card->readData(dst + (uint16_t(i) << 9));
+          // Always end the multi-block read, then fall back to single block reads, which retry on error
+          if (!card->readStop()) ok = false;
+          for (uint8_t i = 0; !ok && i < nb; ++i)
+            if (!vol_->readBlock(block + i, dst + (uint16_t(i) << 9))) return -1;
+          n = uint16_t(nb) << 9;
+        }
+        else
+      #endif
       if (!vol_->readBlock(block, dst)) return -1;
     }
     else {
@@ -1930,6 +1992,33 @@ bool SdBaseFile::seekSet(const uint32_t pos) {
   nCur = (curPosition_ - 1) >> (vol_->clusterSizeShift_ + 9);
   nNew = (pos - 1) >> (vol_->clusterSizeShift_ + 9);
 
+  #ifdef SD_SEEK_INDEX_SIZE
+    if (seekIndexClaim()) {
+      uint32_t n, c;
+      if (nNew <= seekIndex.contiguous) {
+        // contiguous from the start - no need to follow the chain
+        n = nNew;
+        c = firstCluster_ + nNew;
+      }
+      else {
+        // start from the nearest known cluster before the new position
+        uint32_t i = _MIN(nNew / seekIndex.stride, uint32_t(SD_SEEK_INDEX_SIZE - 1));
+        while (i && !seekIndex.cluster[i]) --i;
+        n = i * seekIndex.stride;
+        c = seekIndex.cluster[i];
+        if (seekIndex.contiguous > n) { n = seekIndex.contiguous; c = firstCluster_ + n; }
+        if (curPosition_ && nCur <= nNew && nCur > n) { n = nCur; c = curCluster_; }
+      }
+      while (n < nNew) {
+        if (!vol_->fatGet(c, &c)) return false;
+        seekIndexNote(++n, c);
+      }
+      curCluster_ = c;
+      curPosition_ = pos;
+      return true;
+    }
+  #endif
+
   if (nNew < nCur || curPosition_ == 0)
     curCluster_ = firstCluster_;      // must follow chain from first cluster
   else
@@ -2126,6 +2215,9 @@ bool SdBaseFile::truncate(uint32_t length) {
   // position to last cluster in truncated file
   if (!seekSet(length)) return false;
 
+  // freed clusters may be reused by another file
+  TERN_(SD_SEEK_INDEX_SIZE, if (seekIndexOwned()) dropSeekIndex());
+
   if (length == 0) {
     // free all clusters
     if (!vol_->freeChain(firstCluster_)) return false;
@@ -2224,10 +2316,34 @@ int16_t SdBaseFile::write(const void *buf, const uint16_t nbyte) {
     uint32_t block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
     if (n == 512) {
       // full block - don't need to use cache
-      if (vol_->cacheBlockNumber() == block) {
-        // invalidate cache if block is in cache
-        vol_->cacheSetBlockNumber(0xFFFFFFFF, false);
-      }
+      #ifdef SD_WRITE_BUFFER_BLOCKS
+        // write all the whole blocks left in this cluster with one multi-block write
+        const uint8_t nb = _MIN(nToWrite >> 9, vol_->blocksPerCluster() - blockOfCluster);
+        const uint32_t cached = vol_->cacheBlockNumber();
+        if (cached >= block && cached < block + nb) {
+          // invalidate cache if block is in cache
+          vol_->cacheSetBlockNumber(0xFFFFFFFF, false);
+        }
+        if (nb > 1) {
+          DiskIODriver * const card = vol_->sdCard();
+          bool ok = card->writeStart(block, nb);
+          if (ok) {
+            for (uint8_t i = 0; ok && i < nb; ++i) ok = card->writeData(src + (uint16_t(i) << 9));
+            // Leave multi-block mode so the card stays usable
+            if (!card->writeStop()) ok = false;
+          }
+          // Fall back to single block writes
+          for (uint8_t i = 0; !ok && i < nb; ++i)
+            if (!vol_->writeBlock(block + i, src + (uint16_t(i) << 9))) goto FAIL;
+          n = uint16_t(nb) << 9;
+        }
+        else
+      #else
+        if (vol_->cacheBlockNumber() == block) {
+          // invalidate cache if block is in cache
+          vol_->cacheSetBlockNumber(0xFFFFFFFF, false);
+        }
+      #endif
       if (!vol_->writeBlock(block, src)) goto FAIL;
     }
     else {
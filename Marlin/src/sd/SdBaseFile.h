@@ -187,6 +187,9 @@ class SdBaseFile {
   void setpos(filepos_t * const pos);
 
   bool close();
+  #ifdef SD_SEEK_INDEX_SIZE
+    static void dropSeekIndex() { seekIndex.firstCluster = 0; }
+  #endif
   bool contiguousRange(uint32_t * const bgnBlock, uint32_t * const endBlock);
   bool createContiguous(SdBaseFile * const dirFile, const char * const path, const uint32_t size);
   /**
@@ -369,6 +372,20 @@ class SdBaseFile {
   uint32_t  firstCluster_;  // first cluster of file
   SdVolume  *vol_;          // volume where file is located
 
+  #ifdef SD_SEEK_INDEX_SIZE
+    // Cluster chain index of the last large file read or seeked
+    static struct seek_index_t {
+      SdVolume *vol;                          // Volume and first cluster of the indexed file
+      uint32_t firstCluster,
+               contiguous,                    // Cluster indexes 0..contiguous follow firstCluster in order
+               stride,                        // Cluster indexes between checkpoints
+               cluster[SD_SEEK_INDEX_SIZE];   // Cluster at index i * stride, 0 if not seen yet
+    } seekIndex;
+    bool seekIndexOwned() const { return firstCluster_ && seekIndex.firstCluster == firstCluster_ && seekIndex.vol == vol_; }
+    bool seekIndexClaim();
+    void seekIndexNote(const uint32_t n, const uint32_t cluster);
+  #endif
+
   /**
    * EXPERIMENTAL - Don't use!
    */
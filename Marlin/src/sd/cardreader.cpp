@@ -64,6 +64,14 @@
   #include "../../src/lcd/menu/menu.h"
 #endif
 
+#if ENABLED(SD_COMPRESSED_GCODE)
+  #include "../libs/heatshrink/heatshrink_decoder.h"
+  #if ENABLED(SD_BINARY_GCODE)
+    #include "../feature/meatpack.h"
+    #include "../libs/crc32.h"
+  #endif
+#endif
+
 #define DEBUG_OUT ANY(DEBUG_CARDREADER, MARLIN_DEV_MODE)
 #include "../core/debug_out.h"
 #include "../libs/hex_print.h"
@@ -91,6 +99,10 @@ MediaFile CardReader::root, CardReader::workDir, CardReader::workDirParents[MAX_
 uint8_t CardReader::workDirDepth;
 int16_t CardReader::nrItems = -1;
 
+#ifdef SD_DIR_INDEX_SIZE
+  CardReader::dir_index_t CardReader::dir_index[SD_DIR_INDEX_SIZE];
+#endif
+
 #if ENABLED(SDCARD_SORT_ALPHA)
 
   int16_t CardReader::sort_count;
@@ -152,6 +164,463 @@ MediaFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#ifdef SD_READ_AHEAD_BLOCKS
+
+  uint8_t CardReader::read_ahead[(SD_READ_AHEAD_BLOCKS) * 512];
+  uint16_t CardReader::ra_index, CardReader::ra_count;
+
+  /**
+   * Refill the read-ahead buffer from the current file position.
+   * The first fill after a seek stops at a block boundary so that
+   * later fills are whole, aligned blocks that bypass the volume cache.
+   */
+  bool CardReader::fill_read_ahead() {
+    const int16_t n = file.read(read_ahead, sizeof(read_ahead) - (file.curPosition() & 0x1FF));
+    ra_index = 0;
+    ra_count = _MAX(n, 0);
+    return n > 0;
+  }
+
+#endif
+
+#if ENABLED(SD_COMPRESSED_GCODE)
+
+  /**
+   * Compressed G-code file layout (all values little-endian):
+   *   "HSGC", window bits, lookahead bits, 2 reserved bytes, uncompressed size (uint32)
+   *   Blocks of: compressed size (uint16), uncompressed size (uint16), heatshrink data
+   * Each block is compressed on its own, so seeking only has to walk the block
+   * headers and then decompress within one block.
+   *
+   * Binary G-code (bgcode) files are laid out the same way, with more block types:
+   *   "GCDE", version (uint32), checksum type (uint16)
+   *   Blocks of: type (uint16), compression (uint16), uncompressed size (uint32),
+   *   [compressed size (uint32)], parameters, data, [CRC32 of all the above]
+   * Only G-code blocks are printed. They may also be MeatPack-encoded, and the
+   * length of their text isn't stored. So a G-code block's index is its number
+   * shifted up by BGCODE_BLOCK_SHIFT, and the file size is the block count shifted up.
+   */
+  #define HSGC_HEADER_SIZE 12
+  #define HSGC_BLOCK_HEADER_SIZE 4
+
+  #if ENABLED(SD_BINARY_GCODE)
+    #define BGCODE_HEADER_SIZE 10
+    #define BGCODE_BLOCK_SHIFT 20
+    #define BGCODE_THUMBNAILS 4
+    enum BGCodeBlockType : uint16_t { BGC_FILE_METADATA, BGC_GCODE, BGC_SLICER_METADATA, BGC_PRINTER_METADATA, BGC_PRINT_METADATA, BGC_THUMBNAIL };
+    enum BGCodeCompression : uint16_t { BGC_UNCOMPRESSED, BGC_DEFLATE, BGC_HEATSHRINK_11_4, BGC_HEATSHRINK_12_4 };
+    static_assert(HEATSHRINK_STATIC_LOOKAHEAD_BITS == 4, "Binary G-code needs a heatshrink lookahead of 4 bits.");
+
+    struct bgcode_block_t {
+      uint16_t type, compression, param[3];
+      uint32_t size,      // Uncompressed data size
+               data_pos,  // File position of the data
+               next_pos;  // File position of the next block
+    };
+
+    typedef struct { uint32_t pos; uint16_t size, param[3]; } bgcode_item_t;
+    static bgcode_item_t bgc_thumbs[BGCODE_THUMBNAILS], // Uncompressed thumbnails
+                         bgc_meta[2];                   // Uncompressed printer and print metadata
+    static uint8_t bgc_thumb_count;
+    static MeatPack meatpack(true); // Own lookup table and no state reports
+  #endif
+
+  static heatshrink_decoder hsd;
+  static struct {
+    uint32_t first_pos,     // File position of the first block
+             block_pos,     // File position of the current block header
+             data_pos,      // File position of the current block data
+             next_pos,      // File position of the next block header
+             block_start,   // Index of the first character of the current block
+             next_start,    // Index of the first character of the next block
+             in_left,       // Block data not yet read
+             out_left;      // Block data not yet unpacked
+    bool inflate;           // The block data is heatshrink-compressed
+    #if ENABLED(SD_BINARY_GCODE)
+      bool bgcode,          // The file is binary G-code
+           crc,             // Blocks end with a CRC32
+           meatpack;        // The block data is MeatPack-encoded
+      uint8_t window;       // Heatshrink window bits of the block data
+      uint32_t crc_sum;     // CRC32 of the block so far
+    #endif
+    uint8_t out[32], out_index, out_count;
+  } hs;
+
+  static uint16_t get_u16(const uint8_t * const b) { return b[0] | b[1] << 8; }
+  static uint32_t get_u32(const uint8_t * const b) { return get_u16(b) | uint32_t(get_u16(b + 2)) << 16; }
+
+  #if ENABLED(SD_BINARY_GCODE)
+
+    // Read the header and parameters of the binary G-code block at pos
+    bool CardReader::read_bgcode_block(const uint32_t pos, bgcode_block_t &b) {
+      uint8_t head[12];
+      if (!file.seekSet(pos) || file.read(head, 8) != 8) return false;
+      b.type = get_u16(&head[0]);
+      b.compression = get_u16(&head[2]);
+      b.size = get_u32(&head[4]);
+      uint32_t data_size = b.size;
+      uint8_t len = 8;
+      if (b.compression != BGC_UNCOMPRESSED) {
+        if (file.read(&head[8], 4) != 4) return false;
+        data_size = get_u32(&head[8]);
+        len += 4;
+      }
+      const uint8_t params = b.type == BGC_THUMBNAIL ? 3 : 1;
+      if (file.read(head, params * 2) != params * 2) return false;
+      for (uint8_t i = 0; i < 3; ++i) b.param[i] = i < params ? get_u16(&head[i * 2]) : 0;
+      b.data_pos = pos + len + params * 2;
+      b.next_pos = b.data_pos + data_size + (hs.crc ? 4 : 0);
+      return true;
+    }
+
+    // Walk all the blocks to count the G-code blocks and find metadata and thumbnails
+    bool CardReader::scan_bgcode() {
+      uint32_t count = 0;
+      bgc_thumb_count = 0;
+      bgc_meta[0].size = bgc_meta[1].size = 0;
+      bgcode_block_t b;
+      for (uint32_t pos = hs.first_pos; pos < file.fileSize(); pos = b.next_pos) {
+        if (!read_bgcode_block(pos, b)) return false;
+        const bgcode_item_t item = { b.data_pos, uint16_t(b.size), { b.param[0], b.param[1], b.param[2] } };
+        const bool fits = b.compression == BGC_UNCOMPRESSED && b.size < 0x8000;
+        switch (b.type) {
+          case BGC_GCODE: ++count; break;
+          case BGC_PRINTER_METADATA: if (fits) bgc_meta[0] = item; break;
+          case BGC_PRINT_METADATA: if (fits) bgc_meta[1] = item; break;
+          case BGC_THUMBNAIL: if (fits && bgc_thumb_count < BGCODE_THUMBNAILS) bgc_thumbs[bgc_thumb_count++] = item; break;
+        }
+      }
+      if (count >= _BV32(32 - BGCODE_BLOCK_SHIFT)) return false;
+      filesize = count << BGCODE_BLOCK_SHIFT;
+      return true;
+    }
+
+    // Start the CRC of the current block with its header and parameters
+    bool CardReader::start_block_crc() {
+      uint8_t head[18];
+      const uint8_t n = hs.data_pos - hs.block_pos;
+      if (n > sizeof(head) || !file.seekSet(hs.block_pos) || file.read(head, n) != n) return false;
+      hs.crc_sum = 0;
+      crc32(&hs.crc_sum, head, n);
+      return true;
+    }
+
+    /**
+     * Add the block data the decoder didn't need to the CRC, then check it
+     * against the CRC at the end of the block. The data is only read once, so
+     * a bad block is found when it ends. Its commands have already been queued.
+     */
+    bool CardReader::end_block_crc() {
+      uint8_t buf[32];
+      while (hs.in_left) {
+        const uint16_t n = read_packed(buf, _MIN(uint32_t(sizeof(buf)), hs.in_left));
+        if (!n) return false;
+        crc32(&hs.crc_sum, buf, n);
+        hs.in_left -= n;
+      }
+      if (read_packed(buf, 4) == 4 && hs.crc_sum == get_u32(buf)) return true;
+      SERIAL_ERROR_MSG("Block CRC mismatch at ", hs.block_pos);
+      return false;
+    }
+
+    bool CardReader::isBinaryGcode() { return isFileOpen() && flag.compressed && hs.bgcode; }
+
+    /**
+     * Copy the value of a key in the printer or print metadata of a binary G-code file.
+     * The print position is kept, so this can be used while printing.
+     */
+    bool CardReader::getMetadata(PGM_P const key, char * const value, const uint8_t size) {
+      if (!isBinaryGcode()) return false;
+      const uint32_t oldpos = file.curPosition();
+      const uint8_t keylen = strlen_P(key);
+      bool found = false;
+      for (uint8_t m = 0; m < COUNT(bgc_meta) && !found; ++m) {
+        if (!bgc_meta[m].size || !file.seekSet(bgc_meta[m].pos)) continue;
+        char line[80];
+        uint8_t len = 0;
+        for (uint16_t left = bgc_meta[m].size; left && !found; --left) {
+          char c;
+          if (file.read(&c, 1) != 1) break;
+          const bool eol = c == '\n';
+          if (!eol && len < sizeof(line) - 1) line[len++] = c;
+          if (eol || left == 1) {
+            // Lines are "key=value"
+            line[len] = '\0';
+            if (len > keylen && line[keylen] == '=' && strncmp_P(line, key, keylen) == 0) {
+              strlcpy(value, &line[keylen + 1], size);
+              found = true;
+            }
+            len = 0;
+          }
+        }
+      }
+      file.seekSet(oldpos);
+      return found;
+    }
+
+    /**
+     * Get the size of an uncompressed thumbnail, copying it into buf if given.
+     * The print position is kept, so this can be used while printing.
+     */
+    uint16_t CardReader::getThumbnail(const uint8_t format, const uint16_t width, const uint16_t height, uint8_t * const buf/*=nullptr*/, const uint16_t size/*=0*/) {
+      if (!isBinaryGcode()) return 0;
+      for (uint8_t i = 0; i < bgc_thumb_count; ++i) {
+        const bgcode_item_t &t = bgc_thumbs[i];
+        if (t.param[0] != format || t.param[1] != width || t.param[2] != height) continue;
+        if (buf) {
+          if (size < t.size) return 0;
+          const uint32_t oldpos = file.curPosition();
+          const bool ok = file.seekSet(t.pos) && file.read(buf, t.size) == int16_t(t.size);
+          file.seekSet(oldpos);
+          if (!ok) return 0;
+        }
+        return t.size;
+      }
+      return 0;
+    }
+
+  #endif // SD_BINARY_GCODE
+
+  // Check the open file for a compressed G-code header and prepare to read it
+  bool CardReader::open_compressed() {
+    uint8_t head[HSGC_HEADER_SIZE];
+    TERN_(SD_BINARY_GCODE, hs.window = HEATSHRINK_STATIC_WINDOW_BITS);
+    const bool got = file.read(head, sizeof(head)) == sizeof(head);
+    hs.block_start = hs.next_start = hs.out_left = 0;
+    hs.out_index = hs.out_count = 0;
+
+    #if ENABLED(SD_BINARY_GCODE)
+      hs.bgcode = got && !memcmp(head, "GCDE", 4);
+      hs.crc = hs.bgcode && get_u16(&head[8]) == 1;
+      if (hs.bgcode) {
+        hs.block_pos = hs.next_pos = hs.first_pos = BGCODE_HEADER_SIZE;
+        if (get_u32(&head[4]) == 1 && scan_bgcode()) return true;
+        SERIAL_ERROR_MSG("Unsupported binary G-code");
+        file.close();
+        return false;
+      }
+    #endif
+
+    if (!got || memcmp(head, "HSGC", 4)) {
+      file.seekSet(0);
+      return false;
+    }
+    // With SD_BINARY_GCODE the decoder has room for a larger window
+    const bool window_ok = TERN(SD_BINARY_GCODE,
+      WITHIN(head[4], HEATSHRINK_STATIC_WINDOW_BITS, HEATSHRINK_DECODER_WINDOW_BUFFER_BITS),
+      head[4] == HEATSHRINK_STATIC_WINDOW_BITS
+    );
+    if (!window_ok || head[5] != HEATSHRINK_STATIC_LOOKAHEAD_BITS) {
+      SERIAL_ERROR_MSG("Compressed G-code needs window ", HEATSHRINK_STATIC_WINDOW_BITS, " lookahead ", HEATSHRINK_STATIC_LOOKAHEAD_BITS);
+      file.close();
+      return false;
+    }
+    TERN_(SD_BINARY_GCODE, hs.window = head[4]);
+    filesize = get_u32(&head[8]);
+    hs.block_pos = hs.next_pos = hs.first_pos = HSGC_HEADER_SIZE;
+    return true;
+  }
+
+  // Read compressed bytes from the current file position
+  uint16_t CardReader::read_packed(uint8_t *buf, const uint16_t nbyte) {
+    #ifdef SD_READ_AHEAD_BLOCKS
+      uint16_t got = 0;
+      while (got < nbyte && (ra_index < ra_count || fill_read_ahead())) {
+        const uint16_t n = _MIN(uint16_t(nbyte - got), uint16_t(ra_count - ra_index));
+        memcpy(buf + got, &read_ahead[ra_index], n);
+        ra_index += n;
+        got += n;
+      }
+      return got;
+    #else
+      const int16_t n = file.read(buf, nbyte);
+      return _MAX(n, 0);
+    #endif
+  }
+
+  /**
+   * Make the block at hs.next_pos the current block, reading only its header.
+   * Blocks of binary G-code that aren't G-code are skipped.
+   */
+  bool CardReader::read_packed_header() {
+    discard_read_ahead();
+    #if ENABLED(SD_BINARY_GCODE)
+      if (hs.bgcode) {
+        bgcode_block_t b;
+        do {
+          hs.block_pos = hs.next_pos;
+          if (hs.block_pos >= file.fileSize() || !read_bgcode_block(hs.block_pos, b)) return false;
+          hs.next_pos = b.next_pos;
+        } while (b.type != BGC_GCODE);
+        hs.data_pos = b.data_pos;
+        hs.in_left = b.next_pos - b.data_pos - (hs.crc ? 4 : 0);
+        hs.out_left = b.size;
+        hs.inflate = b.compression != BGC_UNCOMPRESSED;
+        hs.meatpack = b.param[0] != 0;
+        hs.window = b.compression == BGC_HEATSHRINK_11_4 ? 11 : 12;
+        hs.block_start = hs.next_start;
+        hs.next_start += _BV32(BGCODE_BLOCK_SHIFT);
+        return !hs.inflate || b.compression == BGC_HEATSHRINK_11_4 || b.compression == BGC_HEATSHRINK_12_4;
+      }
+    #endif
+    uint8_t head[HSGC_BLOCK_HEADER_SIZE];
+    hs.block_pos = hs.next_pos;
+    if (!file.seekSet(hs.block_pos) || file.read(head, sizeof(head)) != sizeof(head)) return false;
+    hs.data_pos = hs.block_pos + sizeof(head);
+    hs.in_left = get_u16(&head[0]);
+    hs.out_left = get_u16(&head[2]);
+    hs.inflate = true;
+    hs.next_pos = hs.data_pos + hs.in_left;
+    hs.block_start = hs.next_start;
+    hs.next_start += hs.out_left;
+    return true;
+  }
+
+  // Get ready to unpack the current block from its start
+  bool CardReader::start_packed_block() {
+    #if ENABLED(SD_BINARY_GCODE)
+      if (hs.crc && !start_block_crc()) return false;
+      meatpack.reset_state();
+      hsd.window_sz2 = hs.window;
+    #endif
+    discard_read_ahead();
+    if (!file.seekSet(hs.data_pos)) return false;
+    heatshrink_decoder_reset(&hsd);
+    hs.out_index = hs.out_count = 0;
+    sdpos = hs.block_start;
+    return true;
+  }
+
+  // Unpack up to len bytes of block data
+  uint16_t CardReader::unpack_block(uint8_t * const buf, uint16_t len) {
+    NOMORE(len, hs.out_left);
+    size_t n = 0;
+    if (!hs.inflate) {
+      n = read_packed(buf, len);
+      hs.in_left -= n;
+      TERN_(SD_BINARY_GCODE, if (hs.crc) crc32(&hs.crc_sum, buf, n));
+    }
+    else while (len) {
+      if (heatshrink_decoder_poll(&hsd, buf, len, &n) < 0 || n) break;
+      // The decoder needs more input. It takes a full input buffer when it's empty.
+      uint8_t in[HEATSHRINK_STATIC_INPUT_BUFFER_SIZE];
+      const uint16_t got = hs.in_left ? read_packed(in, _MIN(uint32_t(sizeof(in)), hs.in_left)) : 0;
+      if (!got) break;
+      hs.in_left -= got;
+      TERN_(SD_BINARY_GCODE, if (hs.crc) crc32(&hs.crc_sum, in, got));
+      heatshrink_decoder_sink(&hsd, in, got, &n);
+      n = 0;
+    }
+    hs.out_left -= n;
+    #if ENABLED(SD_BINARY_GCODE)
+      // The whole block has been read, so its CRC can be checked
+      if (n && !hs.out_left && hs.crc && !end_block_crc()) return 0;
+    #endif
+    return n;
+  }
+
+  // Bad or truncated data. End the file here instead of retrying forever.
+  int16_t CardReader::packed_error() {
+    if (sdpos < filesize) {
+      SERIAL_ERROR_MSG("Bad compressed G-code at ", sdpos);
+      sdpos = filesize;
+    }
+    return -1;
+  }
+
+  // Get the next decompressed character
+  int16_t CardReader::get_inflated() {
+    while (hs.out_index >= hs.out_count) {
+      if (!hs.out_left) {
+        if (hs.next_start >= filesize) { sdpos = filesize; return -1; }
+        if (!read_packed_header() || !start_packed_block()) return packed_error();
+        continue;
+      }
+      hs.out_index = 0;
+      #if ENABLED(SD_BINARY_GCODE)
+        if (hs.meatpack) {
+          uint8_t packed[sizeof(hs.out) / 2];
+          const uint16_t n = unpack_block(packed, sizeof(packed));
+          if (!n) return packed_error();
+          hs.out_count = 0;
+          for (uint16_t i = 0; i < n; ++i) {
+            meatpack.handle_rx_char(packed[i], 0);
+            hs.out_count += meatpack.get_result_char((char*)&hs.out[hs.out_count]);
+          }
+          continue;
+        }
+      #endif
+      hs.out_count = unpack_block(hs.out, sizeof(hs.out));
+      if (!hs.out_count) return packed_error();
+    }
+
+    if (sdpos >= hs.next_start) return packed_error(); // Too much text for the block index
+    const uint8_t c = hs.out[hs.out_index++];
+    // Reach the end with the last character so a last line with no newline is complete
+    if (++sdpos < filesize && hs.out_index >= hs.out_count && !hs.out_left && hs.next_start >= filesize)
+      sdpos = filesize;
+    return c;
+  }
+
+  // Go to an index, walking the block headers from the current block if possible
+  void CardReader::seek_inflated(const uint32_t index) {
+    const bool back = index < hs.block_start;
+    hs.next_pos = back ? hs.first_pos : hs.block_pos;
+    hs.next_start = back ? 0 : hs.block_start;
+    hs.out_left = hs.out_index = hs.out_count = 0;
+    sdpos = index;
+    if (index >= filesize) return;
+    while (read_packed_header()) {
+      if (index >= hs.next_start) continue;
+      if (!start_packed_block()) break;
+      while (sdpos < index && get_inflated() >= 0) { /* skip */ }
+      return;
+    }
+    packed_error();
+  }
+
+#endif // SD_COMPRESSED_GCODE
+
+#ifdef SD_WRITE_BUFFER_BLOCKS
+
+  uint8_t CardReader::write_buffer[(SD_WRITE_BUFFER_BLOCKS) * 512];
+  uint16_t CardReader::wb_count;
+  millis_t CardReader::wb_flush_ms;
+
+  /**
+   * Write out the buffered data. With whole_blocks only write the whole blocks
+   * and keep the remainder, so the file keeps growing by aligned blocks that
+   * go to the card in one multi-block write.
+   * On failure the data stays in the buffer and the file position is restored,
+   * so the next flush tries the same data again.
+   */
+  bool CardReader::flush_write_buffer(const bool whole_blocks/*=false*/) {
+    const uint16_t len = whole_blocks ? (wb_count & ~0x1FFU) : wb_count;
+    if (!len) return true;
+    if (!file.isOpen()) return false;
+    const uint32_t pos = file.curPosition();
+    if (file.write(write_buffer, len) != int16_t(len)) {
+      file.seekSet(pos);
+      return false;
+    }
+    wb_count -= len;
+    if (wb_count) memmove(write_buffer, write_buffer + len, wb_count);
+    return true;
+  }
+
+  /**
+   * Called from idle(). Data that has waited for 2 seconds is written out and
+   * the directory entry updated, so a log isn't lost if the power goes off.
+   */
+  void CardReader::idle_flush() {
+    if (!wb_count || !isFileOpen() || PENDING(millis(), wb_flush_ms)) return;
+    if (flush_write_buffer() && file.sync()) return;
+    SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
+    wb_flush_ms = millis() + 2000UL; // Try again later
+  }
+
+#endif
+
 CardReader::CardReader() {
   changeMedia(&
     #if HAS_USB_FLASH_DRIVE && !SHARED_VOLUME_IS(SD_ONBOARD)
@@ -232,17 +701,58 @@ bool CardReader::is_visible_entity(const dir_t &p OPTARG(CUSTOM_FIRMWARE_UPLOAD,
     || fileIsBinary()                                   // BIN files are accepted
     || (!onlyBin && p.name[8] == 'G'
                  && p.name[9] != '~')                   // Non-backup *.G* files are accepted
+    #if ENABLED(SD_BINARY_GCODE)
+      || (!onlyBin && p.name[8] == 'B'
+                   && p.name[9] == 'G'
+                   && p.name[10] == 'C')                // *.BGC (bgcode) files are accepted
+    #endif
   );
 }
 
+#ifdef SD_DIR_INDEX_SIZE
+
+  // Case-insensitive hash of a DOS 8.3 name
+  static uint16_t dos_name_hash(const char *name) {
+    uint16_t h = 0;
+    while (*name) h = h * 31 + uint8_t(toupper(*name++));
+    return h;
+  }
+
+  //
+  // Select an item of the working directory using the index
+  //
+  bool CardReader::selectIndexed(const int16_t nr) {
+    dir_t p;
+    if (!workDir.seekSet(uint32_t(dir_index[nr].entry) * sizeof(dir_t))) return false;
+    if (workDir.readDir(&p, longFilename) <= 0 || !is_visible_entity(p)) return false;
+    createFilename(filename, p);
+    return true;
+  }
+
+#endif
+
 //
-// Get the number of (compliant) items in the folder
+// Get the number of (compliant) items in the folder.
+// With SD_DIR_INDEX_SIZE the folder must be the workDir, which gets indexed.
 //
 int16_t CardReader::countVisibleItems(MediaFile dir) {
   dir_t p;
   int16_t c = 0;
   dir.rewind();
-  while (dir.readDir(&p, longFilename) > 0) c += is_visible_entity(p);
+  #ifdef SD_DIR_INDEX_SIZE
+    // Start each lookup where the previous readDir left off, before any long name entries
+    for (uint32_t pos = 0; dir.readDir(&p, longFilename) > 0; pos = dir.curPosition()) {
+      if (!is_visible_entity(p)) continue;
+      if (c < SD_DIR_INDEX_SIZE) {
+        char dosName[FILENAME_LENGTH];
+        createFilename(dosName, p);
+        dir_index[c] = { uint16_t(pos / sizeof(dir_t)), dos_name_hash(dosName) };
+      }
+      c++;
+    }
+  #else
+    while (dir.readDir(&p, longFilename) > 0) c += is_visible_entity(p);
+  #endif
   return c;
 }
 
@@ -485,6 +995,7 @@ void CardReader::printSelectedFilename() {
 void CardReader::mount() {
   flag.mounted = false;
   nrItems = -1;
+  TERN_(SD_SEEK_INDEX_SIZE, MediaFile::dropSeekIndex());
   if (root.isOpen()) root.close();
 
   if (!driver->init(SD_SPI_SPEED, SDSS)
@@ -630,7 +1141,13 @@ void CardReader::endFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/))
   TERN_(ADVANCED_PAUSE_FEATURE, did_pause_print = 0);
   TERN_(DWIN_CREALITY_LCD, hmiFlag.print_finish = flag.sdprinting);
   flag.abort_sd_printing = false;
-  if (isFileOpen()) file.close();
+  if (isFileOpen()) {
+    flush_write_buffer();
+    file.close();
+  }
+  discard_write_buffer();
+  discard_read_ahead();
+  TERN_(SD_COMPRESSED_GCODE, flag.compressed = false);
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
@@ -735,6 +1252,11 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    discard_read_ahead();
+    #if ENABLED(SD_COMPRESSED_GCODE)
+      flag.compressed = open_compressed();
+      if (!file.isOpen()) return openFailed(fname);
+    #endif
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -771,6 +1293,7 @@ void CardReader::openFileWrite(const char * const path) {
   #if DISABLED(SDCARD_READONLY)
     if (file.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
       flag.saving = true;
+      nrItems = -1;
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
       echo_write_to_file(fname);
@@ -826,6 +1349,7 @@ void CardReader::removeFile(const char * const name) {
     if (file.remove(itsDirPtr, fname)) {
       SERIAL_ECHOLNPGM("File deleted:", fname);
       sdpos = 0;
+      nrItems = -1;
       TERN_(SDCARD_SORT_ALPHA, presort());
     }
     else
@@ -865,7 +1389,20 @@ void CardReader::write_command(char * const buf) {
   end[1] = '\r';
   end[2] = '\n';
   end[3] = '\0';
-  file.write(begin);
+
+  #ifdef SD_WRITE_BUFFER_BLOCKS
+    // A command is much shorter than a block, so it always fits after a flush
+    const uint16_t len = end + 3 - begin;
+    if (wb_count + len > sizeof(write_buffer) && !flush_write_buffer(true))
+      file.writeError = true; // The buffer is still full, so this command is lost
+    else {
+      if (!wb_count) wb_flush_ms = millis() + 2000UL;
+      memcpy(write_buffer + wb_count, begin, len);
+      wb_count += len;
+    }
+  #else
+    file.write(begin);
+  #endif
 
   if (file.writeError) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
 }
@@ -978,6 +1515,7 @@ void CardReader::write_command(char * const buf) {
 
     if (foundName[0]) {
       workDir = foundDir;
+      nrItems = -1;
       workDir.rewind();
       selectByName(workDir, foundName);
       //workDir.close(); // Not needed?
@@ -989,10 +1527,14 @@ void CardReader::write_command(char * const buf) {
 #endif // ONE_CLICK_PRINT
 
 void CardReader::closefile(const bool store_location/*=false*/) {
+  if (!flush_write_buffer()) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
   file.sync();
   file.close();
   flag.saving = flag.logging = false;
   sdpos = 0;
+  discard_write_buffer();
+  discard_read_ahead();
+  TERN_(SD_COMPRESSED_GCODE, flag.compressed = false);
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
   if (store_location) {
@@ -1014,6 +1556,9 @@ void CardReader::selectFileByIndex(const int16_t nr) {
       return;
     }
   #endif
+  #ifdef SD_DIR_INDEX_SIZE
+    if (WITHIN(nr, 0, _MIN(nrItems, SD_DIR_INDEX_SIZE) - 1) && selectIndexed(nr)) return;
+  #endif
   workDir.rewind();
   selectByIndex(workDir, nr);
 }
@@ -1032,6 +1577,14 @@ void CardReader::selectFileByName(const char * const match) {
         return;
       }
   #endif
+  #ifdef SD_DIR_INDEX_SIZE
+    if (nrItems >= 0) {
+      const uint16_t hash = dos_name_hash(match);
+      for (int16_t nr = 0; nr < _MIN(nrItems, SD_DIR_INDEX_SIZE); nr++)
+        if (dir_index[nr].hash == hash && selectIndexed(nr) && strcasecmp(match, filename) == 0)
+          return;
+    }
+  #endif
   workDir.rewind();
   selectByName(workDir, match);
 }
@@ -1130,6 +1683,7 @@ const char* CardReader::diveToFile(const bool update_cwd, MediaFile* &inDirPtr,
 
   if (update_cwd) {
     workDir = *inDirPtr;
+    nrItems = -1;
     DEBUG_ECHOLNPGM(" final workDir = ", hex_address((void*)inDirPtr));
     flag.workDirIsRoot = (workDirDepth == 0);
     TERN_(SDCARD_SORT_ALPHA, presort());
@@ -1417,6 +1971,8 @@ int16_t CardReader::get_num_items() {
 //
 void CardReader::fileHasFinished() {
   file.close();
+  discard_read_ahead();
+  TERN_(SD_COMPRESSED_GCODE, flag.compressed = false);
   #if HAS_MEDIA_SUBCALLS
     if (file_subcall_ctr > 0) { // Resume calling file after closing procedure
       file_subcall_ctr--;
@@ -1454,6 +2010,23 @@ void CardReader::fileHasFinished() {
       echo_write_to_file(recovery.filename);
   }
 
+  #ifdef POWER_LOSS_JOURNAL
+
+    // Open the recovery file for update in place, optionally (re)creating it
+    // as a contiguous file of the given size. No truncate, no cluster allocation.
+    bool CardReader::openJobRecoveryJournal(const uint32_t size, const bool create) {
+      if (!isMounted()) return false;
+      if (recovery.file.isOpen()) return true;
+      if (recovery.file.open(&root, recovery.filename, O_RDWR)) {
+        if (recovery.file.fileSize() == size) return true;
+        if (!create) { recovery.file.close(); return false; }
+        recovery.file.remove();
+      }
+      return create && recovery.file.createContiguous(&root, recovery.filename, size);
+    }
+
+  #endif
+
   // Removing the job recovery file currently requires closing
   // the file being printed, so during SD printing the file should
   // be zeroed and written instead of deleted.
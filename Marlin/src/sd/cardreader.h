@@ -87,6 +87,9 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1        // Use the serial line buffer as BinaryStream input
        #endif
+       #if ENABLED(SD_COMPRESSED_GCODE)
+         , compressed:1         // The open file is compressed G-code. Indexes are uncompressed.
+       #endif
     ;
 } card_flags_t;
 
@@ -125,6 +128,11 @@ public:
   // Handle media insert/remove
   static void manage_media();
 
+  #ifdef SD_WRITE_BUFFER_BLOCKS
+    // Write out buffered M28/M928 data that has waited too long
+    static void idle_flush();
+  #endif
+
   // SD Card Logging
   static void openLogFile(const char * const path);
   static void write_command(char * const buf);
@@ -224,6 +232,9 @@ public:
     static bool jobRecoverFileExists();
     static void openJobRecoveryFile(const bool read);
     static void removeJobRecoveryFile();
+    #ifdef POWER_LOSS_JOURNAL
+      static bool openJobRecoveryJournal(const uint32_t size, const bool create);
+    #endif
   #endif
 
   // Binary flag for the current file
@@ -241,10 +252,40 @@ public:
   static bool eof()              { return getIndex() >= getFileSize(); }
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
-  static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
-  static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  #ifdef SD_READ_AHEAD_BLOCKS
+    static int16_t get() {
+      TERN_(SD_COMPRESSED_GCODE, if (flag.compressed) return get_inflated());
+      if (ra_index >= ra_count && !fill_read_ahead()) return -1;
+      sdpos++;
+      return read_ahead[ra_index++];
+    }
+    static int16_t read(void *buf, uint16_t nbyte)  { sync_read_ahead(); return file.isOpen() ? file.read(buf, nbyte) : -1; }
+    static int16_t write(void *buf, uint16_t nbyte) { sync_read_ahead(); flush_write_buffer(); return file.isOpen() ? file.write(buf, nbyte) : -1; }
+    static void setIndex(const uint32_t index) {
+      TERN_(SD_COMPRESSED_GCODE, if (flag.compressed) return seek_inflated(index));
+      discard_read_ahead();
+      file.seekSet((sdpos = index));
+    }
+  #else
+    static int16_t get() {
+      TERN_(SD_COMPRESSED_GCODE, if (flag.compressed) return get_inflated());
+      int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out;
+    }
+    static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+    static int16_t write(void *buf, uint16_t nbyte) { flush_write_buffer(); return file.isOpen() ? file.write(buf, nbyte) : -1; }
+    static void setIndex(const uint32_t index) {
+      TERN_(SD_COMPRESSED_GCODE, if (flag.compressed) return seek_inflated(index));
+      file.seekSet((sdpos = index));
+    }
+  #endif
+
+  #if ENABLED(SD_BINARY_GCODE)
+    // Binary G-code metadata and thumbnails
+    enum BGCodeImage : uint8_t { BGC_PNG, BGC_JPG, BGC_QOI };
+    static bool isBinaryGcode();
+    static bool getMetadata(PGM_P const key, char * const value, const uint8_t size);
+    static uint16_t getThumbnail(const uint8_t format, const uint16_t width, const uint16_t height, uint8_t * const buf=nullptr, const uint16_t size=0);
+  #endif
 
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
@@ -275,6 +316,13 @@ private:
   static uint8_t workDirDepth;
   static int16_t nrItems; // Cache the total count
 
+  #ifdef SD_DIR_INDEX_SIZE
+    // Directory entry and DOS name hash of the first items in workDir, valid while nrItems >= 0
+    typedef struct { uint16_t entry, hash; } dir_index_t;
+    static dir_index_t dir_index[SD_DIR_INDEX_SIZE];
+    static bool selectIndexed(const int16_t nr);
+  #endif
+
   //
   // Alphabetical file and folder sorting
   //
@@ -337,6 +385,57 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  //
+  // Read-ahead buffer for get()
+  //
+  #ifdef SD_READ_AHEAD_BLOCKS
+    static uint8_t read_ahead[(SD_READ_AHEAD_BLOCKS) * 512];
+    static uint16_t ra_index, ra_count;   // Next byte to return, bytes in the buffer
+    static bool fill_read_ahead();
+    static void discard_read_ahead() { ra_index = ra_count = 0; }
+    // Put the file position back where get() left off before direct access
+    static void sync_read_ahead() {
+      if (ra_index < ra_count) file.seekSet(sdpos);
+      discard_read_ahead();
+    }
+  #else
+    static void discard_read_ahead() {}
+  #endif
+
+  //
+  // Compressed G-code playback
+  //
+  #if ENABLED(SD_COMPRESSED_GCODE)
+    static bool open_compressed();
+    static uint16_t read_packed(uint8_t *buf, const uint16_t nbyte);
+    static bool read_packed_header();
+    static bool start_packed_block();
+    static uint16_t unpack_block(uint8_t * const buf, uint16_t len);
+    static int16_t packed_error();
+    static int16_t get_inflated();
+    static void seek_inflated(const uint32_t index);
+    #if ENABLED(SD_BINARY_GCODE)
+      static bool read_bgcode_block(const uint32_t pos, struct bgcode_block_t &b);
+      static bool scan_bgcode();
+      static bool start_block_crc();
+      static bool end_block_crc();
+    #endif
+  #endif
+
+  //
+  // Buffer for write_command()
+  //
+  #ifdef SD_WRITE_BUFFER_BLOCKS
+    static uint8_t write_buffer[(SD_WRITE_BUFFER_BLOCKS) * 512];
+    static uint16_t wb_count;             // Bytes waiting to be written
+    static millis_t wb_flush_ms;          // Time to write out data that is still waiting
+    static bool flush_write_buffer(const bool whole_blocks=false);
+    static void discard_write_buffer() { wb_count = 0; }
+  #else
+    static bool flush_write_buffer(const bool=false) { return true; }
+    static void discard_write_buffer() {}
+  #endif
+
   //
   // Procedure calls to other files
   //
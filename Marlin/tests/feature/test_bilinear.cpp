@@ -0,0 +1,94 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../test/unit_tests.h"
+
+#if ENABLED(ABL_BILINEAR_COEFFICIENTS) && DISABLED(ABL_BILINEAR_SUBDIVISION)
+
+#include <src/feature/bedlevel/bedlevel.h>
+#include <chrono>
+
+// A bumpy, tilted bed
+static void fill_mesh() {
+  bedlevel.set_grid(xy_pos_t({ 50.0f, 40.0f }), xy_pos_t({ 10.0f, 20.0f }));
+  GRID_LOOP(x, y) bedlevel.z_values[x][y] = 0.01f * x - 0.02f * y + ((x ^ y) & 1 ? 0.05f : -0.03f);
+  bedlevel.refresh_bed_level();
+}
+
+// Plain bilinear interpolation holding the height of the grid edges
+static float reference_z(const xy_pos_t &raw) {
+  const float fx = constrain((raw.x - bedlevel.grid_start.x) / bedlevel.grid_spacing.x, 0, GRID_MAX_CELLS_X),
+              fy = constrain((raw.y - bedlevel.grid_start.y) / bedlevel.grid_spacing.y, 0, GRID_MAX_CELLS_Y);
+  const uint8_t x0 = _MIN(uint8_t(fx), (GRID_MAX_CELLS_X) - 1), y0 = _MIN(uint8_t(fy), (GRID_MAX_CELLS_Y) - 1);
+  const float u = fx - x0, v = fy - y0,
+              z0 = bedlevel.z_values[x0][y0] + u * (bedlevel.z_values[x0 + 1][y0] - bedlevel.z_values[x0][y0]),
+              z1 = bedlevel.z_values[x0][y0 + 1] + u * (bedlevel.z_values[x0 + 1][y0 + 1] - bedlevel.z_values[x0][y0 + 1]);
+  return z0 + v * (z1 - z0);
+}
+
+MARLIN_TEST(bilinear, grid_points_are_exact) {
+  fill_mesh();
+  GRID_LOOP(x, y) {
+    const xy_pos_t p = { bedlevel.get_mesh_x(x), bedlevel.get_mesh_y(y) };
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, bedlevel.z_values[x][y], bedlevel.get_z_correction(p));
+  }
+}
+
+MARLIN_TEST(bilinear, matches_reference_inside_and_beyond_grid) {
+  fill_mesh();
+  // Walk a diagonal zig-zag so both X and Y change on every call
+  for (int i = 0; i < 2000; ++i) {
+    const xy_pos_t p = { -20.0f + (i * 37 % 290), -10.0f + (i * 53 % 230) };
+    #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+      if (!WITHIN(p.x, bedlevel.grid_start.x, bedlevel.get_mesh_x(GRID_MAX_CELLS_X))) continue;
+      if (!WITHIN(p.y, bedlevel.grid_start.y, bedlevel.get_mesh_y(GRID_MAX_CELLS_Y))) continue;
+    #endif
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, reference_z(p), bedlevel.get_z_correction(p));
+  }
+}
+
+MARLIN_TEST(bilinear, refresh_follows_mesh_changes) {
+  fill_mesh();
+  const xy_pos_t p = { bedlevel.get_mesh_x(1) + 10.0f, bedlevel.get_mesh_y(2) + 5.0f };
+  const float before = bedlevel.get_z_correction(p);
+  bedlevel.z_values[1][2] += 0.5f;
+  bedlevel.refresh_bed_level();
+  TEST_ASSERT_GREATER_THAN(before + 0.1f, bedlevel.get_z_correction(p));
+}
+
+MARLIN_TEST(bilinear, benchmark) {
+  fill_mesh();
+  constexpr int N = 200000;
+  xy_pos_t pts[64];
+  for (int i = 0; i < 64; ++i) pts[i].set(10.0f + (i * 29 % 200), 20.0f + (i * 43 % 160));
+
+  // X and Y both change on every call, as with segmented leveled moves
+  volatile float sink = 0;
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < N; ++i) sink = sink + bedlevel.get_z_correction(pts[i & 63]);
+  const auto t1 = std::chrono::steady_clock::now();
+
+  const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / N;
+  printf("  get_z_correction: %.1f ns/call\n", ns);
+  TEST_ASSERT_TRUE(ns > 0);
+}
+
+#endif
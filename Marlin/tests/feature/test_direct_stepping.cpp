@@ -0,0 +1,209 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(DIRECT_STEPPING) && STEPPER_PAGE_FORMAT == SP_4xND
+
+#include <src/feature/direct_stepping.h>
+#include <vector>
+
+using namespace DirectStepping;
+
+typedef std::vector<uint8_t> bytes_t;
+struct segment_t { int8_t x, y, z, e; };
+
+// Access to the received pages and their states
+class TestPageManager : public PageManager {
+public:
+  static PageState page_state(const page_idx_t i) { return page_states[i]; }
+  static uint8_t* page(const page_idx_t i) { return pages[i]; }
+};
+
+// Encode segments the way a host planner would
+static bytes_t encode_page(const uint8_t bits, const std::vector<segment_t> &segments) {
+  bytes_t data;
+  for (const segment_t &s : segments) {
+    if (bits == 8) {
+      data.push_back(uint8_t(s.x)); data.push_back(uint8_t(s.y));
+      data.push_back(uint8_t(s.z)); data.push_back(uint8_t(s.e));
+    }
+    else {
+      data.push_back(uint8_t(((s.x + 7) << 4) | (s.y + 7)));
+      data.push_back(uint8_t(((s.z + 7) << 4) | (s.e + 7)));
+    }
+  }
+  return data;
+}
+
+// Page header for SP_4xND: control char, page index, segment bits, 16-bit size
+static bytes_t page_header(const uint8_t idx, const uint8_t bits, const uint16_t size) {
+  return bytes_t{ '\n', Config::CONTROL_CHAR, idx, bits, uint8_t(size & 0xFF), uint8_t(size >> 8) };
+}
+
+static uint8_t page_checksum(const bytes_t &data) {
+  uint8_t cs = 0;
+  for (const uint8_t b : data) cs ^= b;
+  return cs;
+}
+
+// Replay a page one character at a time, as from the serial RX interrupt
+static void send_by_char(const uint8_t idx, const uint8_t bits, const bytes_t &data, const uint8_t checksum) {
+  for (const uint8_t c : page_header(idx, bits, data.size())) PageManager::maybe_store_rxd_char(c);
+  for (const uint8_t c : data) TEST_ASSERT_TRUE(PageManager::maybe_store_rxd_char(c));
+  TEST_ASSERT_TRUE(PageManager::maybe_store_rxd_char(checksum));
+}
+
+// Replay a page with the body written in place, as by DMA
+static void send_in_place(const uint8_t idx, const uint8_t bits, const bytes_t &data, const size_t chunk) {
+  for (const uint8_t c : page_header(idx, bits, data.size())) PageManager::maybe_store_rxd_char(c);
+  for (size_t done = 0; done < data.size();) {
+    uint16_t room;
+    uint8_t * const span = PageManager::claim_rx_span(room);
+    TEST_ASSERT_NOT_NULL(span);
+    TEST_ASSERT_EQUAL(data.size() - done, room);
+    const uint16_t count = _MIN(room, chunk);
+    memcpy(span, &data[done], count);
+    PageManager::commit_rx_span(count);
+    done += count;
+  }
+  uint16_t room;
+  TEST_ASSERT_NULL(PageManager::claim_rx_span(room));
+  TEST_ASSERT_TRUE(PageManager::maybe_store_rxd_char(page_checksum(data)));
+}
+
+// Step through a page and check each segment produces its steps in both directions
+static void replay_steps(const uint8_t idx, const std::vector<segment_t> &segments) {
+  page_step_state_t ps{};
+  ps.page = TestPageManager::page(idx);
+  ps.bits = PageManager::get_page_bits(idx);
+  const uint32_t ticks = PageManager::get_page_steps(idx), per_segment = ticks / segments.size();
+  TEST_ASSERT_EQUAL(ps.bits == 8 ? 127 : Config::SEGMENT_STEPS, per_segment);
+
+  int32_t total[4] = { 0 };
+  for (const segment_t &s : segments) {
+    int32_t moved[4] = { 0 };
+    for (uint32_t t = 0; t < per_segment; ++t) {
+      const uint8_t steps = page_step_bits(ps);
+      for (uint8_t i = 0; i < 4; ++i)
+        if (TEST(steps, 3 - i)) moved[i] += TEST(ps.dir, 3 - i) ? 1 : -1;
+    }
+    const int8_t expect[4] = { s.x, s.y, s.z, s.e };
+    for (uint8_t i = 0; i < 4; ++i) {
+      TEST_ASSERT_EQUAL(expect[i], moved[i]);
+      total[i] += moved[i];
+    }
+  }
+  for (uint8_t i = 0; i < 4; ++i) TEST_ASSERT_EQUAL(total[i], ps.delta[i]);
+}
+
+static std::vector<segment_t> make_segments(const uint8_t bits, const uint16_t count) {
+  const int limit = bits == 8 ? 127 : 7;
+  std::vector<segment_t> segments;
+  for (uint16_t i = 0; i < count; ++i) {
+    const int v = int(i * 37 % (2 * limit + 1)) - limit;
+    segments.push_back({ int8_t(v), int8_t(-v), int8_t(i % 3 - 1), int8_t(limit - (i % (limit + 1))) });
+  }
+  return segments;
+}
+
+MARLIN_TEST(direct_stepping, receive_4bit_page_by_char) {
+  PageManager::init();
+  const std::vector<segment_t> segments = make_segments(4, Config::PAGE_SIZE / 2);
+  const bytes_t data = encode_page(4, segments);
+  send_by_char(1, 4, data, page_checksum(data));
+
+  TEST_ASSERT_EQUAL(PageState::OK, TestPageManager::page_state(1));
+  TEST_ASSERT_EQUAL_MEMORY(data.data(), TestPageManager::page(1), data.size());
+  TEST_ASSERT_EQUAL(4, PageManager::get_page_bits(1));
+  TEST_ASSERT_EQUAL(segments.size() * Config::SEGMENT_STEPS, PageManager::get_page_steps(1));
+  replay_steps(1, segments);
+}
+
+MARLIN_TEST(direct_stepping, receive_8bit_page_in_place) {
+  PageManager::init();
+  const std::vector<segment_t> segments = make_segments(8, 100);
+  const bytes_t data = encode_page(8, segments);
+  send_in_place(2, 8, data, 64);
+
+  TEST_ASSERT_EQUAL(PageState::OK, TestPageManager::page_state(2));
+  TEST_ASSERT_EQUAL_MEMORY(data.data(), TestPageManager::page(2), data.size());
+  TEST_ASSERT_EQUAL(8, PageManager::get_page_bits(2));
+  TEST_ASSERT_EQUAL(100 * 127, PageManager::get_page_steps(2));
+  replay_steps(2, segments);
+}
+
+MARLIN_TEST(direct_stepping, mixed_formats) {
+  PageManager::init();
+  const std::vector<segment_t> seg4 = make_segments(4, 50), seg8 = make_segments(8, 50);
+  const bytes_t data4 = encode_page(4, seg4), data8 = encode_page(8, seg8);
+  send_in_place(0, 8, data8, 1000);
+  send_by_char(3, 4, data4, page_checksum(data4));
+
+  TEST_ASSERT_EQUAL(PageState::OK, TestPageManager::page_state(0));
+  TEST_ASSERT_EQUAL(PageState::OK, TestPageManager::page_state(3));
+  replay_steps(0, seg8);
+  replay_steps(3, seg4);
+}
+
+MARLIN_TEST(direct_stepping, bad_checksum_fails_page) {
+  PageManager::init();
+  const bytes_t data = encode_page(8, make_segments(8, 16));
+  send_by_char(5, 8, data, page_checksum(data) ^ 0x55);
+  TEST_ASSERT_EQUAL(PageState::FAIL, TestPageManager::page_state(5));
+
+  // The host clears the failure before sending the page again
+  for (const uint8_t c : bytes_t{ '\n', Config::CONTROL_CHAR, 5, 0 }) PageManager::maybe_store_rxd_char(c);
+  TEST_ASSERT_EQUAL(PageState::FREE, TestPageManager::page_state(5));
+
+  send_in_place(5, 8, data, 7);
+  TEST_ASSERT_EQUAL(PageState::OK, TestPageManager::page_state(5));
+}
+
+MARLIN_TEST(direct_stepping, bad_header_is_rejected) {
+  PageManager::init();
+  // Segment bits of 0 or 1 must not reach the size check
+  for (const uint8_t bits : { 0, 1 })
+    for (const uint8_t c : page_header(2, bits, 16)) PageManager::maybe_store_rxd_char(c);
+  TEST_ASSERT_FALSE(PageManager::maybe_store_rxd_char(0));
+
+  // Pages that don't exist have no steps
+  TEST_ASSERT_EQUAL(0, PageManager::get_page_steps(Config::PAGE_COUNT));
+  TEST_ASSERT_EQUAL(0, PageManager::get_page_bits(Config::PAGE_COUNT));
+}
+
+MARLIN_TEST(direct_stepping, minus_128_steps_as_minus_127) {
+  PageManager::init();
+  // A segment can't make more than 127 steps, so the position must count no more
+  const std::vector<segment_t> sent = { { -128, 127, -128, 0 } }, moved = { { -127, 127, -127, 0 } };
+  const bytes_t data = encode_page(8, sent);
+  send_by_char(4, 8, data, page_checksum(data));
+  TEST_ASSERT_EQUAL(PageState::OK, TestPageManager::page_state(4));
+  replay_steps(4, moved);
+}
+
+MARLIN_TEST(direct_stepping, gcode_passes_through) {
+  PageManager::init();
+  for (const char c : "G6 I1\n") TEST_ASSERT_FALSE(PageManager::maybe_store_rxd_char(c));
+}
+
+#endif
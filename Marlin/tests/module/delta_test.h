@@ -0,0 +1,37 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * delta_test.h - Shared setup for the delta kinematics tests
+ */
+
+#include <src/module/delta.h>
+
+// Reset the delta geometry to the configured values
+inline void setup_delta() {
+  delta_radius = DELTA_RADIUS;
+  delta_diagonal_rod = DELTA_DIAGONAL_ROD;
+  delta_tower_angle_trim.reset();
+  delta_diagonal_rod_trim.reset();
+  recalc_delta_settings();
+}
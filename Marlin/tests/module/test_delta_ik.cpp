@@ -0,0 +1,127 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../test/unit_tests.h"
+
+#if ENABLED(DELTA_IK_BATCH)
+
+#include "delta_test.h"
+#include <src/module/motion.h>
+#include <chrono>
+
+// Tower columns of a single point, the same as inverse_kinematics
+static abc_float_t reference_cols(const xy_pos_t &p) {
+  const xyz_pos_t v = { p.x, p.y, 0 };
+  return { DELTA_Z(v, A_AXIS), DELTA_Z(v, B_AXIS), DELTA_Z(v, C_AXIS) };
+}
+
+// Largest column error of batches along a few lines with the given step length
+static float batch_error(const float step_mm) {
+  float worst = 0;
+  abc_float_t cols[DELTA_IK_BATCH_SIZE];
+  for (int n = 0; n < 64; ++n) {
+    const float a = RADIANS(n * 37), r = 10.0f + (n * 13 % 50);
+    xy_pos_t start, step;
+    start.set(r * cos(a), r * sin(a));
+    step.set(step_mm * cos(a * 3), step_mm * sin(a * 3));
+    inverse_kinematics_batch(start, step, DELTA_IK_BATCH_SIZE, cols);
+    for (uint8_t i = 0; i < DELTA_IK_BATCH_SIZE; ++i) {
+      xy_pos_t p;
+      p.set(start.x + i * step.x, start.y + i * step.y);
+      const abc_float_t ref = reference_cols(p);
+      LOOP_ABC(t) NOLESS(worst, ABS(cols[i][t] - ref[t]));
+    }
+  }
+  return worst;
+}
+
+// Allow for float rounding on top of the Taylor bound
+static constexpr float max_error = TERN(DELTA_IK_TAYLOR, DELTA_IK_TAYLOR_TOLERANCE, 0) + 0.0002f;
+
+MARLIN_TEST(delta_ik, first_point_is_exact) {
+  setup_delta();
+  xy_pos_t start, step;
+  start.set(-30.0f, 55.0f);
+  step.set(0.4f, -0.3f);
+  abc_float_t cols[DELTA_IK_BATCH_SIZE];
+  inverse_kinematics_batch(start, step, DELTA_IK_BATCH_SIZE, cols);
+  const abc_float_t ref = reference_cols(start);
+  LOOP_ABC(t) TEST_ASSERT_FLOAT_WITHIN(1e-4f, ref[t], cols[0][t]);
+}
+
+MARLIN_TEST(delta_ik, batch_matches_inverse_kinematics) {
+  setup_delta();
+  TEST_ASSERT_FLOAT_WITHIN(max_error, 0, batch_error(0.1f));
+  TEST_ASSERT_FLOAT_WITHIN(max_error, 0, batch_error(0.5f));
+  TEST_ASSERT_FLOAT_WITHIN(max_error, 0, batch_error(2.0f));
+  // Long segments fall back to exact square roots
+  TEST_ASSERT_FLOAT_WITHIN(max_error, 0, batch_error(5.0f));
+}
+
+MARLIN_TEST(delta_ik, short_batch) {
+  setup_delta();
+  xy_pos_t start, step;
+  start.set(20.0f, 0);
+  step.set(1.0f, 1.0f);
+  abc_float_t cols[2];
+  inverse_kinematics_batch(start, step, 2, cols);
+  xy_pos_t p;
+  p.set(21.0f, 1.0f);
+  const abc_float_t ref = reference_cols(p);
+  LOOP_ABC(t) TEST_ASSERT_FLOAT_WITHIN(max_error, ref[t], cols[1][t]);
+}
+
+MARLIN_TEST(delta_ik, benchmark) {
+  setup_delta();
+  constexpr int N = 200000 / (DELTA_IK_BATCH_SIZE) * (DELTA_IK_BATCH_SIZE);
+
+  // One point at a time, as the segmenter did before
+  volatile float sink = 0;
+  xyz_pos_t raw{0};
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < N; ++i) {
+    raw.set(-50.0f + (i & 255) * 0.4f, 30.0f - (i & 255) * 0.2f, 0);
+    inverse_kinematics(raw);
+    sink = sink + delta.a;
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  const double ns_single = std::chrono::duration<double, std::nano>(t1 - t0).count() / N;
+  printf("  inverse_kinematics: %.1f ns/segment (%.0f segments/s)\n", ns_single, 1e9 / ns_single);
+
+  // Segments per second and worst error for a few segment lengths
+  for (const float step_mm : { 0.1f, 0.5f, 2.0f }) {
+    abc_float_t cols[DELTA_IK_BATCH_SIZE];
+    xy_pos_t start, step;
+    step.set(step_mm * 0.8f, step_mm * -0.6f);
+    const auto t2 = std::chrono::steady_clock::now();
+    for (int i = 0; i < N; i += DELTA_IK_BATCH_SIZE) {
+      start.set(-50.0f + (i & 255) * 0.4f, 30.0f - (i & 255) * 0.2f);
+      inverse_kinematics_batch(start, step, DELTA_IK_BATCH_SIZE, cols);
+      sink = sink + cols[DELTA_IK_BATCH_SIZE - 1].a;
+    }
+    const auto t3 = std::chrono::steady_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(t3 - t2).count() / N;
+    printf("  batch, %.1f mm steps: %.1f ns/segment (%.0f segments/s), max error %.6f mm\n", step_mm, ns, 1e9 / ns, batch_error(step_mm));
+    TEST_ASSERT_TRUE(ns > 0);
+  }
+}
+
+#endif
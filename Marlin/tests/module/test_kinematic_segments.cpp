@@ -0,0 +1,120 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../test/unit_tests.h"
+
+#if ALL(DELTA, ADAPTIVE_KINEMATIC_SEGMENTS)
+
+#include "delta_test.h"
+#include <src/module/motion.h>
+
+struct segment_stats_t { int blocks; float max_dev; };
+
+// Distance from the line a-b of the point the machine reaches between joint positions ja and jb
+static float worst_deviation(const xyz_pos_t &a, const xyz_pos_t &b, const abce_pos_t &ja, const abce_pos_t &jb) {
+  const xyz_float_t u = (b - a) * (1.0f / (b - a).magnitude());
+  float worst = 0;
+  for (int i = 1; i < 8; ++i) {
+    const float f = i / 8.0f;
+    forward_kinematics(ja.a + (jb.a - ja.a) * f, ja.b + (jb.b - ja.b) * f, ja.c + (jb.c - ja.c) * f);
+    const xyz_float_t p = cartes - a, off = p - u * (p.x * u.x + p.y * u.y + p.z * u.z);
+    NOLESS(worst, off.magnitude());
+  }
+  return worst;
+}
+
+// Split a move the way line_to_destination_kinematic does, with fixed or adaptive segments
+static segment_stats_t segment_move(const xyz_pos_t &start, const xyz_pos_t &end, const bool adaptive) {
+  const xyz_float_t diff = end - start;
+  const float mm = diff.magnitude(),
+              inv_segments = 1.0f / _MAX(1, int(DEFAULT_SEGMENTS_PER_SECOND * mm / 100.0f)), // at 100mm/s
+              dt_max = _MAX(inv_segments, _MIN(1.0f, float(ADAPTIVE_SEGMENT_MAX_LENGTH) / mm));
+  segment_stats_t stats = { 0, 0 };
+  float t = 0, guess = inv_segments;
+  inverse_kinematics(start);
+  abce_pos_t prev = delta;
+  for (bool last = false; !last;) {
+    float dt;
+    if (adaptive)
+      dt = next_segment_fraction(start, diff, t, inv_segments, dt_max, guess);
+    else {
+      dt = inv_segments;
+      if (t + dt >= 1.0f - 0.5f * inv_segments) dt = 1.0f - t;
+    }
+    last = dt >= 1.0f - t;
+    inverse_kinematics(last ? end : start + diff * (t + dt));
+    const abce_pos_t next = delta;
+    NOLESS(stats.max_dev, worst_deviation(start, end, prev, next));
+    prev = next;
+    t += dt;
+    stats.blocks++;
+  }
+  return stats;
+}
+
+static void report(const char * const name, const xyz_pos_t &start, const xyz_pos_t &end, segment_stats_t &fixed, segment_stats_t &adaptive) {
+  fixed = segment_move(start, end, false);
+  adaptive = segment_move(start, end, true);
+  printf("  %s: fixed %d blocks (max deviation %.4f mm), adaptive %d blocks (max deviation %.4f mm)\n",
+    name, fixed.blocks, fixed.max_dev, adaptive.blocks, adaptive.max_dev);
+}
+
+MARLIN_TEST(kinematic_segments, straight_joint_path_has_no_sag) {
+  setup_delta();
+  // A purely vertical move is linear in joint space
+  xyz_pos_t a, b;
+  a.set(20.0f, 30.0f, 0);
+  b.set(20.0f, 30.0f, 50.0f);
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, 0, kinematic_segment_sag(a, b));
+}
+
+MARLIN_TEST(kinematic_segments, sag_grows_with_length) {
+  setup_delta();
+  xyz_pos_t a, b1, b2;
+  a.set(-60.0f, -60.0f, 0);
+  b1.set(-50.0f, -60.0f, 0);
+  b2.set(-40.0f, -60.0f, 0);
+  TEST_ASSERT_TRUE(kinematic_segment_sag(a, b2) > kinematic_segment_sag(a, b1) * 2);
+}
+
+MARLIN_TEST(kinematic_segments, fewer_blocks_within_tolerance) {
+  setup_delta();
+  constexpr float max_dev = ADAPTIVE_SEGMENT_TOLERANCE;
+  segment_stats_t fixed, adaptive;
+  xyz_pos_t a, b;
+
+  a.set(-100.0f, 0, 0); b.set(100.0f, 0, 0);
+  report("through center", a, b, fixed, adaptive);
+  TEST_ASSERT_LESS_THAN(fixed.blocks, adaptive.blocks);
+  TEST_ASSERT_FLOAT_WITHIN(max_dev, 0, adaptive.max_dev);
+
+  a.set(-90.0f, -100.0f, 0); b.set(90.0f, -100.0f, 0);
+  report("near edge", a, b, fixed, adaptive);
+  TEST_ASSERT_LESS_OR_EQUAL(fixed.blocks, adaptive.blocks);
+  TEST_ASSERT_FLOAT_WITHIN(max_dev, 0, adaptive.max_dev);
+
+  a.set(-80.0f, -40.0f, 0); b.set(70.0f, 60.0f, 5.0f);
+  report("diagonal", a, b, fixed, adaptive);
+  TEST_ASSERT_LESS_OR_EQUAL(fixed.blocks, adaptive.blocks);
+  TEST_ASSERT_FLOAT_WITHIN(max_dev, 0, adaptive.max_dev);
+}
+
+#endif
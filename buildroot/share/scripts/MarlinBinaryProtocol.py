@@ -2,7 +2,14 @@
 # MarlinBinaryProtocol.py
 # Supporting Firmware upload via USB/Serial, saving to the attached media.
 #
+# Usage: MarlinBinaryProtocol.py [options] PORT FILE [DEST]
+#
+# PORT may be a device or a pySerial URL, e.g. socket://localhost:8099 for the simulator.
+# With --window the host keeps several packets in flight when the firmware has
+# BINARY_STREAM_WINDOW, and only resends the packets that were lost.
+#
 import serial
+import os
 import math
 import time
 from collections import deque
@@ -60,6 +67,9 @@ class Protocol(object):
     packet_buffer = None
     simulate_errors = 0
     sync = 0
+    window = 0          # Packets allowed in flight, 0 for stop-and-wait
+    window_request = 0
+    in_flight = None    # Unacknowledged packets by sync id: [packet, time sent]
     connected = False
     syncronised = False
     worker_thread = None
@@ -69,17 +79,19 @@ class Protocol(object):
     applications = []
     responses = deque()
 
-    def __init__(self, device, baud, bsize, simerr, timeout):
+    def __init__(self, device, baud, bsize, simerr, timeout, window = 0):
         print("pySerial Version:", serial.VERSION)
-        self.port = serial.Serial(device, baudrate = baud, write_timeout = 0, timeout = 1)
+        self.port = serial.serial_for_url(device, baudrate = baud, write_timeout = 0, timeout = 1)
         self.device = device
         self.baud = baud
-        self.block_size = int(bsize)
+        self.block_size = self.requested_block_size = int(bsize)
         self.simulate_errors = max(min(simerr, 1.0), 0.0)
         self.connected = True
         self.response_timeout = timeout
+        self.window_request = int(window)
+        self.in_flight = {}
 
-        self.register(['ok', 'rs', 'ss', 'fe'], self.process_input)
+        self.register(['ok', 'rs', 'ss', 'sw', 'fe'], self.process_input)
 
         self.worker_thread = threading.Thread(target=Protocol.receive_worker, args=(self,))
         self.worker_thread.start()
@@ -101,7 +113,7 @@ class Protocol(object):
             for x in range(10):
                 try:
                     if self.connected:
-                        self.port = serial.Serial(self.device, baudrate = self.baud, write_timeout = 0, timeout = 1)
+                        self.port = serial.serial_for_url(self.device, baudrate = self.baud, write_timeout = 0, timeout = 1)
                         return
                     else:
                         print("Connection closed")
@@ -135,6 +147,11 @@ class Protocol(object):
         self.applications.append((tokens, callback))
 
     def send(self, protocol, packet_type, data = bytearray()):
+        if self.window:
+            self.send_windowed(protocol, packet_type, data)
+            self.flush_window()
+            return
+
         self.packet_transit = self.build_packet(protocol, packet_type, data)
         self.packet_status = 0
         self.transmit_attempt = 0
@@ -158,11 +175,41 @@ class Protocol(object):
             if timeout.timedout():
                 raise ReadTimeout()
 
+        self.process_responses()
+
+    def process_responses(self):
         while len(self.responses):
             token, data = self.responses.popleft()
-            switch = {'ok' : self.response_ok, 'rs': self.response_resend, 'ss' : self.response_stream_sync, 'fe' : self.response_fatal_error}
+            switch = {'ok' : self.response_ok, 'rs': self.response_resend, 'ss' : self.response_stream_sync, 'sw' : self.response_window, 'fe' : self.response_fatal_error}
             switch[token](data)
 
+    # Send without waiting for the 'ok' while the window has room
+    def send_windowed(self, protocol, packet_type, data = bytearray()):
+        while len(self.in_flight) >= self.window:
+            self.await_window()
+        packet = self.build_packet(protocol, packet_type, data)
+        self.in_flight[self.sync] = [packet, millis()]
+        self.sync = (self.sync + 1) % 256
+        self.transmit_packet(packet)
+
+    def flush_window(self):
+        while len(self.in_flight):
+            self.await_window()
+
+    # Handle the next responses, resending the oldest packet if it goes unanswered
+    def await_window(self):
+        timeout = TimeOut(self.response_timeout * 20)
+        while not len(self.responses):
+            if timeout.timedout():
+                raise ConnectionLost()
+            oldest = self.in_flight[next(iter(self.in_flight))]
+            if millis() - oldest[1] > self.response_timeout:
+                self.errors += 1
+                self.transmit_packet(oldest[0])
+                oldest[1] = millis()
+            time.sleep(0.00001)
+        self.process_responses()
+
     def send_ascii(self, data, send_and_forget = False):
         self.packet_transit = bytearray(data, "utf8") + b'\n'
         self.packet_status = 0
@@ -263,16 +310,38 @@ class Protocol(object):
         print("Connecting: Switching Marlin to Binary Protocol...")
         self.send_ascii("M28B1")
         self.send(0, 1)
+        if self.window_request:
+            self.negotiate_window(self.window_request)
 
     def disconnect(self):
         self.send(0, 2)
+        self.window = 0
         self.syncronised = False
 
+    # Firmware without BINARY_STREAM_WINDOW doesn't answer, so stay with stop-and-wait
+    def negotiate_window(self, size):
+        self.window_reply = None
+        self.send(0, 3, bytearray([min(size, 255)]))
+        timeout = TimeOut(self.response_timeout)
+        while self.window_reply is None and not timeout.timedout():
+            self.process_responses()
+            time.sleep(0.0001)
+        if self.window:
+            print("Sending {0} packets ahead, {1} byte payload".format(self.window, self.block_size))
+
     def response_ok(self, data):
         try:
             packet_id = int(data)
         except ValueError:
             return
+        if self.window:
+            # Everything up to packet_id has arrived
+            while len(self.in_flight):
+                oldest = next(iter(self.in_flight))
+                if (packet_id - oldest) % 256 >= self.window:
+                    break
+                del self.in_flight[oldest]
+            return
         if packet_id != self.sync:
             raise SycronisationError()
         self.sync = (self.sync + 1) % 256
@@ -281,6 +350,12 @@ class Protocol(object):
     def response_resend(self, data):
         packet_id = int(data)
         self.errors += 1
+        if self.window:
+            # Resend only the packet that was lost
+            if packet_id in self.in_flight:
+                self.transmit_packet(self.in_flight[packet_id][0])
+                self.in_flight[packet_id][1] = millis()
+            return
         if not self.syncronised:
             print("Retrying syncronisation")
         elif packet_id != self.sync:
@@ -296,6 +371,14 @@ class Protocol(object):
         self.syncronised = True
         print("Connection synced [{0}], binary protocol version {1}, {2} byte payload buffer".format(self.sync, self.protocol_version, self.max_block_size))
 
+    def response_window(self, data):
+        fields = data.split(',')
+        self.window_reply = int(fields[0])
+        if self.window_reply and len(fields) > 1:
+            self.max_block_size = int(fields[1])
+            self.block_size = min(self.requested_block_size, self.max_block_size)
+        self.window = self.window_reply
+
     def response_fatal_error(self, data):
         raise FatalError()
 
@@ -372,7 +455,10 @@ class FileTransferProtocol(object):
         raise ReadTimeout()
 
     def write(self, data):
-        self.protocol.send(FileTransferProtocol.protocol_id, FileTransferProtocol.Packet.WRITE, data)
+        if self.protocol.window:
+            self.protocol.send_windowed(FileTransferProtocol.protocol_id, FileTransferProtocol.Packet.WRITE, data)
+        else:
+            self.protocol.send(FileTransferProtocol.protocol_id, FileTransferProtocol.Packet.WRITE, data)
 
     def close(self):
         self.protocol.send(FileTransferProtocol.protocol_id, FileTransferProtocol.Packet.CLOSE)
@@ -425,7 +511,7 @@ class FileTransferProtocol(object):
             if (i / blocks) >= dump_pctg:
                 print("\r{0:2.0f}% {1:4.2f}KiB/s {2} Errors: {3}".format((i / blocks) * 100, kibs, "[{0:4.2f}KiB/s]".format(kibs * cratio) if compression else "", self.protocol.errors), end='')
                 dump_pctg += 0.1
-            if self.protocol.errors > 0:
+            if self.protocol.errors > 0 and not self.protocol.window:
                 # Dump last status (errors may not be visible)
                 print("\r{0:2.0f}% {1:4.2f}KiB/s {2} Errors: {3} - Aborting...".format((i / blocks) * 100, kibs, "[{0:4.2f}KiB/s]".format(kibs * cratio) if compression else "", self.protocol.errors), end='')
                 print("")   # New line to break the transfer speed line
@@ -449,3 +535,31 @@ class EchoProtocol(object):
 
     def process_input(self, data):
         print(data)
+
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser(description="Copy a file to the printer's media with the binary file transfer protocol.")
+    parser.add_argument('port', help="serial device or pySerial URL, e.g. /dev/ttyACM0 or socket://localhost:8099")
+    parser.add_argument('file', help="file to send")
+    parser.add_argument('dest', nargs='?', help="name on the media, defaults to the name of FILE")
+    parser.add_argument('-b', '--baud', type=int, default=250000)
+    parser.add_argument('-s', '--block-size', type=int, default=512, help="largest payload per packet")
+    parser.add_argument('-w', '--window', type=int, default=8, help="packets in flight, 0 for stop-and-wait")
+    parser.add_argument('-t', '--timeout', type=int, default=1000, help="response timeout in ms")
+    parser.add_argument('-e', '--error-rate', type=float, default=0.0, help="simulate transmit errors, 0.0 to 1.0")
+    parser.add_argument('-c', '--compress', action='store_true', help="compress with heatshrink")
+    parser.add_argument('-d', '--dummy', action='store_true', help="transfer without writing to the media")
+    args = parser.parse_args()
+
+    protocol = Protocol(args.port, args.baud, args.block_size, args.error_rate, args.timeout, args.window)
+    echo = EchoProtocol(protocol)
+    filetransfer = FileTransferProtocol(protocol)
+    transferOK = False
+    try:
+        protocol.connect()
+        transferOK = filetransfer.copy(args.file, args.dest or os.path.basename(args.file), args.compress, args.dummy)
+        protocol.disconnect()
+    finally:
+        protocol.shutdown()
+    sys.exit(0 if transferOK else 1)
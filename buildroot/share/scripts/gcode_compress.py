@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+#
+# gcode_compress.py
+# Compress a G-code file for printing from media with SD_COMPRESSED_GCODE.
+#
+# Usage: gcode_compress.py INPUT_FILE OUTPUT_FILE [BLOCK_SIZE] [WINDOW_BITS]
+#
+# WINDOW_BITS must match HEATSHRINK_STATIC_WINDOW_BITS in the firmware (8).
+# With SD_BINARY_GCODE the firmware also takes up to 12.
+#
+# The output is a 12 byte header ("HSGC", window bits, lookahead bits,
+# 2 reserved bytes, uncompressed size) followed by independently compressed
+# blocks, each with a 4 byte header (compressed size, uncompressed size).
+# Give the output a .gco (or other .g*) extension so the firmware lists it.
+#
+import sys, struct
+try:
+    import heatshrink2 as heatshrink
+except ImportError:
+    import heatshrink
+
+LOOKAHEAD_BITS = 4
+
+def compress(data, block_size, window_bits):
+    out = bytearray(b'HSGC')
+    out += struct.pack('<BBHI', window_bits, LOOKAHEAD_BITS, 0, len(data))
+    for i in range(0, len(data), block_size):
+        block = data[i:i + block_size]
+        packed = heatshrink.encode(block, window_sz2=window_bits, lookahead_sz2=LOOKAHEAD_BITS)
+        out += struct.pack('<HH', len(packed), len(block))
+        out += packed
+    return out
+
+if __name__ == '__main__':
+    if len(sys.argv) < 3:
+        print("Usage: gcode_compress.py INPUT_FILE OUTPUT_FILE [BLOCK_SIZE] [WINDOW_BITS]")
+        sys.exit(1)
+
+    block_size = int(sys.argv[3]) if len(sys.argv) > 3 else 8192
+    if not 256 <= block_size <= 32768:
+        print("BLOCK_SIZE must be between 256 and 32768")
+        sys.exit(1)
+
+    window_bits = int(sys.argv[4]) if len(sys.argv) > 4 else 8
+    if window_bits not in (8, 12):
+        print("WINDOW_BITS must be 8 or 12")
+        sys.exit(1)
+
+    with open(sys.argv[1], 'rb') as f: data = f.read()
+    packed = compress(data, block_size, window_bits)
+    with open(sys.argv[2], 'wb') as f: f.write(packed)
+    print("%s: %d -> %d bytes (%.1f%%)" % (sys.argv[2], len(data), len(packed), 100.0 * len(packed) / max(len(data), 1)))